@@ -3,19 +3,83 @@ import matplotlib.pyplot as plt
 
 df = pd.read_csv("results/tempos.csv")
 
-plt.figure(figsize=(10,6))
-
-for algoritmo in df["Algoritmo"].unique():
-    dados = df[df["Algoritmo"] == algoritmo].sort_values(by="Tamanho")
-    plt.plot(dados["Tamanho"], dados["Tempo"], marker="o", label=algoritmo)
-
-plt.xscale("symlog")
-plt.xlabel("Tamanho da entrada (n)")
-plt.ylabel("Tempo de execução (s)")
-plt.title("Comparação de Desempenho dos Algoritmos de Ordenação")
-plt.legend()
-plt.grid(True, which="both", linestyle="--", alpha=0.6)
-
-plt.tight_layout()
-plt.savefig("results/grafico_comparacao.png", dpi=300)
-plt.show()
+# CSVs antigos não têm as colunas Distribuicao e Threads
+if "Distribuicao" not in df.columns:
+    df["Distribuicao"] = "uniforme"
+if "Threads" not in df.columns:
+    df["Threads"] = 1
+
+# Contadores de desempenho (--contadores); vazios quando não medidos
+CONTADORES = ["Ciclos", "Instrucoes", "FalhasDesvio", "FalhasLLC", "FalhasDTLB"]
+contadores = [coluna for coluna in CONTADORES if coluna in df.columns]
+
+# Com --repeticoes há várias linhas por ponto: usa a mediana
+df = df.groupby(["Distribuicao", "Algoritmo", "Threads", "Tamanho"], as_index=False)[["Tempo"] + contadores].median()
+
+if len(contadores) == len(CONTADORES):
+    df["IPC"] = df["Instrucoes"] / df["Ciclos"]
+    df["InstrucoesPorElemento"] = df["Instrucoes"] / df["Tamanho"]
+    df["FalhasDesvioPorElemento"] = df["FalhasDesvio"] / df["Tamanho"]
+    df["FalhasLLCPorElemento"] = df["FalhasLLC"] / df["Tamanho"]
+    df["FalhasDTLBPorElemento"] = df["FalhasDTLB"] / df["Tamanho"]
+
+# Gráficos dos contadores: coluna e rótulo do eixo y, ao lado do tempo
+GRAFICOS_CONTADORES = [
+    ("Tempo", "Tempo de execução (s)"),
+    ("IPC", "Instruções por ciclo (IPC)"),
+    ("InstrucoesPorElemento", "Instruções por elemento"),
+    ("FalhasDesvioPorElemento", "Falhas de desvio por elemento"),
+    ("FalhasLLCPorElemento", "Falhas de LLC por elemento"),
+    ("FalhasDTLBPorElemento", "Falhas de dTLB por elemento"),
+]
+
+
+def plotar(eixo, df_dist, coluna):
+    """Uma curva de 'coluna' por tamanho para cada algoritmo (e número de threads)."""
+    for algoritmo in df_dist["Algoritmo"].unique():
+        df_alg = df_dist[df_dist["Algoritmo"] == algoritmo]
+        varias_threads = df_alg["Threads"].nunique() > 1
+
+        for threads in sorted(df_alg["Threads"].unique()):
+            dados = df_alg[df_alg["Threads"] == threads].sort_values(by="Tamanho")
+            dados = dados[dados[coluna].notna()]
+            if dados.empty:
+                continue
+            rotulo = f"{algoritmo} ({threads} threads)" if varias_threads else algoritmo
+            eixo.plot(dados["Tamanho"], dados[coluna], marker="o", label=rotulo)
+
+    eixo.set_xscale("symlog")
+    eixo.set_xlabel("Tamanho da entrada (n)")
+    eixo.grid(True, which="both", linestyle="--", alpha=0.6)
+
+
+# Um gráfico por distribuição; o da uniforme continua em grafico_comparacao.png
+for distribuicao in df["Distribuicao"].unique():
+    df_dist = df[df["Distribuicao"] == distribuicao]
+
+    plt.figure(figsize=(10,6))
+    plotar(plt.gca(), df_dist, "Tempo")
+    plt.ylabel("Tempo de execução (s)")
+    plt.title(f"Comparação de Desempenho dos Algoritmos de Ordenação ({distribuicao})")
+    plt.legend()
+
+    plt.tight_layout()
+    if distribuicao == "uniforme":
+        plt.savefig("results/grafico_comparacao.png", dpi=300)
+    plt.savefig(f"results/grafico_comparacao_{distribuicao}.png", dpi=300)
+    plt.close()
+
+    # Contadores de desempenho, apenas se algum foi medido nesta distribuição
+    if "IPC" not in df_dist.columns or df_dist[contadores].isna().all().all():
+        continue
+
+    figura, eixos = plt.subplots(2, 3, figsize=(18, 10))
+    for eixo, (coluna, rotulo) in zip(eixos.flat, GRAFICOS_CONTADORES):
+        plotar(eixo, df_dist, coluna)
+        eixo.set_ylabel(rotulo)
+    eixos.flat[0].legend(fontsize="small")
+    figura.suptitle(f"Contadores de Desempenho dos Algoritmos de Ordenação ({distribuicao})")
+
+    figura.tight_layout()
+    figura.savefig(f"results/grafico_contadores_{distribuicao}.png", dpi=300)
+    plt.close(figura)
@@ -5,96 +5,411 @@
     Este é o arquivo principal do projeto, responsável por orquestrar a execução dos algoritmos de ordenação
     (Merge Sort e Radix Sort) em diferentes versões: sequencial, com threads e com CUDA (GPU).
     O fluxo geral é:
-        1. Define os arquivos de entrada e seus tamanhos
-        2. Gera os arquivos binários com dados aleatórios
-        3. Executa cada versão dos algoritmos de ordenação
-        4. Mede e registra os tempos de execução em um arquivo CSV
-        5. Verifica se os arquivos foram ordenados corretamente após cada execução
+        1. Lê as opções de linha de comando (utils/linha_comando.h): algoritmos, tamanhos,
+           números de threads, distribuições, repetições, aquecimento, saída e semente;
+           sem argumentos, executa todos os algoritmos com os tamanhos padrão
+        2. Gera os arquivos binários com dados aleatórios, em cada uma das distribuições
+           de distribuicoes.h (uniforme, ordenada, inversa, zipf, ...), uma única vez em
+           dados/cache; antes de cada execução as entradas são restauradas do cache
+        3. Executa cada algoritmo escolhido do registro (algoritmos_benchmark) para cada
+           distribuição e número de threads
+        4. Mede os tempos de execução (utils/medicao.h: repetições, aquecimento, mediana,
+           percentis e fixação das threads) e, com --contadores, os contadores de desempenho
+           (utils/contadores.h), e os registra em um arquivo CSV
+        5. Verifica se os arquivos foram ordenados corretamente após cada algoritmo (ou,
+           nos modos de seleção, se os k menores elementos foram selecionados)
+
+    Com o argumento --grande, executa o teste de entrada grande (OpcoesGrande).
 */
 
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "utils/utils.h"
+#include "utils/linha_comando.h"
 #include "ordenadores/sequencial/merge_sort_seq.h"
+#include "ordenadores/sequencial/merge_sort_simd.h"
+#include "ordenadores/sequencial/merge_sort_adaptativo.h"
 #include "ordenadores/threads/merge_sort_threads.h"
+#include "ordenadores/threads/merge_sort_tarefas.h"
+#include "ordenadores/threads/sample_sort_threads.h"
 #include "ordenadores/cuda/merge_sort_cuda.cu"
 #include "ordenadores/sequencial/radix_sort_seq.h"
+#include "ordenadores/sequencial/radix_sort_msd.h"
+#include "ordenadores/sequencial/selecao_seq.h"
 #include "ordenadores/threads/radix_sort_threads.h"
+#include "ordenadores/threads/radix_msd_threads.h"
+#include "ordenadores/threads/selecao_threads.h"
 #include "ordenadores/cuda/radix_sort_cuda.cu"
+#include "ordenadores/externo/merge_sort_externo.h"
+
+
+// ============================================================
+//                  Registro dos algoritmos
+// ============================================================
+/*
+    Estrutura AlgoritmoBenchmark: um algoritmo que pode ser escolhido na linha de comando.
+
+    Campos:
+        - nome: nome usado em --algoritmos
+        - descricao: descrição impressa por --listar
+        - usa_threads: executado uma vez para cada valor de --threads
+        - aceita_negativos: se falso, não é executado nas distribuições com negativos
+        - executar: chama a função Exec* do algoritmo, com o rótulo da distribuição das entradas
+        - gerar_entrada: NULL para os algoritmos de int, que usam as distribuições; senão,
+          gera as próprias entradas (de outro tipo), que são então guardadas no cache, e
+          retorna o rótulo da distribuição delas
+        - verificar: VerificarOrdenado com o tipo dos elementos
+ */
+struct AlgoritmoBenchmark {
+    const char *nome;
+    const char *descricao;
+    bool usa_threads;
+    bool aceita_negativos;
+    void (*executar)(const char **entradas, int num_entradas, int num_threads, const char *distribuicao,
+                     const OpcoesBenchmark *opcoes);
+    const char *(*gerar_entrada)(const long *tamanhos, const char **entradas, const int num_entradas, uint64_t semente);
+    void (*verificar)(const char **entradas, const int num_entradas);
+};
+
+const AlgoritmoBenchmark algoritmos_benchmark[] = {
+    {"merge_seq", "Merge Sort sequencial", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeSeq(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"merge_seq_pingpong", "Merge Sort sequencial com buffer ping-pong (sem alocações por merge)", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeSeqPingPong(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"merge_simd", "Merge Sort sequencial com merge SIMD (AVX-512 / AVX2, com fallback escalar)", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeSimd(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"merge_adaptativo", "Merge Sort natural adaptativo (runs, política Powersort e galope)", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeAdaptativo(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"merge_threads", "Merge Sort com threads", true, true,
+     [](const char **e, int n, int t, const char *d, const OpcoesBenchmark *o) { ExecMergeThread(e, n, t, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"merge_tarefas", "Merge Sort recursivo com tarefas e roubo de trabalho (work stealing)", true, true,
+     [](const char **e, int n, int t, const char *d, const OpcoesBenchmark *o) { ExecMergeTarefas(e, n, t, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"sample_threads", "Sample Sort com threads", true, true,
+     [](const char **e, int n, int t, const char *d, const OpcoesBenchmark *o) { ExecSampleSortThread(e, n, t, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"merge_cuda", "Merge Sort com CUDA (GPU)", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeCuda(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"radix_seq", "Radix Sort sequencial decimal (apenas valores não negativos)", false, false,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixSeq(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"radix_seq_base256", "Radix Sort sequencial em base 256", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixSeqBase256(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"radix_threads", "Radix Sort com threads", true, true,
+     [](const char **e, int n, int t, const char *d, const OpcoesBenchmark *o) { ExecRadixThread(e, n, t, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"radix_msd", "Radix Sort MSD no próprio lugar (American flag sort), sem buffer auxiliar", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixMSD(e, n, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"radix_msd_threads", "Radix Sort MSD no próprio lugar com threads (baldes do primeiro nível divididos)", true, true,
+     [](const char **e, int n, int t, const char *d, const OpcoesBenchmark *o) { ExecRadixMSDThread(e, n, t, o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+    {"merge_externo", "Merge Sort externo (out-of-core), com runs temporárias gravadas em dados/", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeExterno(e, n, o->memoria_externo, "dados", o->csv_saida, d); },
+     NULL, VerificarOrdenado<int>},
+
+    // Modos de seleção: apenas os k = --selecao * n menores elementos (utils/selecao.h)
+    {"nth_quickselect", "Seleção do k-ésimo menor (nth_element) com quickselect", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecQuickselect(e, n, o->csv_saida, d); },
+     NULL, VerificarSelecao<SELECAO_NTH>},
+    {"nth_radix", "Seleção do k-ésimo menor (nth_element) com radix select", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixSelect(e, n, o->csv_saida, d); },
+     NULL, VerificarSelecao<SELECAO_NTH>},
+    {"nth_radix_threads", "Seleção do k-ésimo menor (nth_element) com radix select e threads", true, true,
+     [](const char **e, int n, int t, const char *d, const OpcoesBenchmark *o) { ExecRadixSelectThread(e, n, t, o->csv_saida, d); },
+     NULL, VerificarSelecao<SELECAO_NTH>},
+    {"topk_heap", "Top-k: os k menores em ordem, com max-heap de k elementos", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecTopKHeap(e, n, o->csv_saida, d); },
+     NULL, VerificarSelecao<SELECAO_PREFIXO>},
+    {"parcial_quickselect", "Ordenação parcial: os k menores em ordem, com quickselect e radix MSD", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecOrdenacaoParcial(e, n, o->csv_saida, d); },
+     NULL, VerificarSelecao<SELECAO_PREFIXO>},
+
+    // Radix Sort Sequencial em base 256 com a faixa completa de cada tipo (inclui negativos)
+    {"radix_chaves_int32", "Radix Sort em base 256, int32_t na faixa completa", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixSeqChaves<int32_t>(e, n, o->csv_saida, d); },
+     GerarArquivosFaixaCompleta<int32_t>, VerificarOrdenado<int32_t>},
+    {"radix_chaves_uint64", "Radix Sort em base 256, uint64_t na faixa completa", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixSeqChaves<uint64_t>(e, n, o->csv_saida, d); },
+     GerarArquivosFaixaCompleta<uint64_t>, VerificarOrdenado<uint64_t>},
+    {"radix_chaves_int64", "Radix Sort em base 256, int64_t na faixa completa", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixSeqChaves<int64_t>(e, n, o->csv_saida, d); },
+     GerarArquivosFaixaCompleta<int64_t>, VerificarOrdenado<int64_t>},
+    {"radix_chaves_float", "Radix Sort em base 256, float na faixa completa", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixSeqChaves<float>(e, n, o->csv_saida, d); },
+     GerarArquivosFaixaCompleta<float>, VerificarOrdenado<float>},
+
+    // Registros (chave int + carga) nos layouts AoS e SoA, e argsort; chaves na distribuição DIST_REGISTROS
+    {"merge_registros_aos", "Merge Sort de pares (chave, linha) em AoS", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeRegistros<uint32_t>(e, n, o->csv_saida, d, LAYOUT_AOS); },
+     GerarArquivosRegistros<uint32_t, LAYOUT_AOS>, VerificarRegistros<uint32_t, LAYOUT_AOS>},
+    {"merge_registros_soa", "Merge Sort de pares (chave, linha) em SoA", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeRegistros<uint32_t>(e, n, o->csv_saida, d, LAYOUT_SOA); },
+     GerarArquivosRegistros<uint32_t, LAYOUT_SOA>, VerificarRegistros<uint32_t, LAYOUT_SOA>},
+    {"merge_registros_largo_aos", "Merge Sort de registros de 16 bytes em AoS", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeRegistros<CargaLarga>(e, n, o->csv_saida, d, LAYOUT_AOS); },
+     GerarArquivosRegistros<CargaLarga, LAYOUT_AOS>, VerificarRegistros<CargaLarga, LAYOUT_AOS>},
+    {"merge_registros_largo_soa", "Merge Sort de registros de 16 bytes em SoA", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecMergeRegistros<CargaLarga>(e, n, o->csv_saida, d, LAYOUT_SOA); },
+     GerarArquivosRegistros<CargaLarga, LAYOUT_SOA>, VerificarRegistros<CargaLarga, LAYOUT_SOA>},
+    {"radix_registros_aos", "Radix Sort em base 256 de pares (chave, linha) em AoS", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixRegistros<uint32_t>(e, n, o->csv_saida, d, LAYOUT_AOS); },
+     GerarArquivosRegistros<uint32_t, LAYOUT_AOS>, VerificarRegistros<uint32_t, LAYOUT_AOS>},
+    {"radix_registros_soa", "Radix Sort em base 256 de pares (chave, linha) em SoA", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixRegistros<uint32_t>(e, n, o->csv_saida, d, LAYOUT_SOA); },
+     GerarArquivosRegistros<uint32_t, LAYOUT_SOA>, VerificarRegistros<uint32_t, LAYOUT_SOA>},
+    {"radix_registros_largo_aos", "Radix Sort em base 256 de registros de 16 bytes em AoS", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixRegistros<CargaLarga>(e, n, o->csv_saida, d, LAYOUT_AOS); },
+     GerarArquivosRegistros<CargaLarga, LAYOUT_AOS>, VerificarRegistros<CargaLarga, LAYOUT_AOS>},
+    {"radix_registros_largo_soa", "Radix Sort em base 256 de registros de 16 bytes em SoA", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixRegistros<CargaLarga>(e, n, o->csv_saida, d, LAYOUT_SOA); },
+     GerarArquivosRegistros<CargaLarga, LAYOUT_SOA>, VerificarRegistros<CargaLarga, LAYOUT_SOA>},
+    {"argsort_merge", "Argsort (permutação que ordena as chaves) com Merge Sort", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecArgsortMerge(e, n, o->csv_saida, d); },
+     GerarArquivosArgsort, VerificarArgsort},
+    {"argsort_radix", "Argsort (permutação que ordena as chaves) com Radix Sort em base 256", false, true,
+     [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecArgsortRadix(e, n, o->csv_saida, d); },
+     GerarArquivosArgsort, VerificarArgsort},
+
+    // Radix Sort com CUDA (GPU) **(WIP)
+    // {"radix_cuda", "Radix Sort com CUDA (GPU)", false, true,
+    //  [](const char **e, int n, int, const char *d, const OpcoesBenchmark *o) { ExecRadixCuda(e, n, o->csv_saida, d); },
+    //  NULL, VerificarOrdenado<int>},
+};
+
+const int num_algoritmos_benchmark = (int)(sizeof(algoritmos_benchmark) / sizeof(algoritmos_benchmark[0]));
+
+/*
+    BuscarAlgoritmo: algoritmo do registro com o nome dado, ou NULL se não existir.
+ */
+const AlgoritmoBenchmark *BuscarAlgoritmo(const char *nome)
+{
+    for (int i = 0; i < num_algoritmos_benchmark; i++)
+    {
+        if (strcmp(algoritmos_benchmark[i].nome, nome) == 0)
+        {
+            return &algoritmos_benchmark[i];
+        }
+    }
+    return NULL;
+}
+
+// ============================================================
+//                  Execução dos algoritmos
+// ============================================================
+/*
+    NomeEntrada: caminho do arquivo de entrada com 'n' elementos (ex.: dados/250k.bin,
+    dados/2m500.bin, dados/100m.bin).
+ */
+void NomeEntrada(long n, char *caminho, size_t tamanho)
+{
+    if (n >= 1000000 && n % 1000 == 0)
+    {
+        long resto = (n % 1000000) / 1000;
+        if (resto == 0)
+            snprintf(caminho, tamanho, "dados/%ldm.bin", n / 1000000);
+        else
+            snprintf(caminho, tamanho, "dados/%ldm%03ld.bin", n / 1000000, resto);
+    }
+    else if (n >= 1000 && n % 1000 == 0)
+    {
+        snprintf(caminho, tamanho, "dados/%ldk.bin", n / 1000);
+    }
+    else
+    {
+        snprintf(caminho, tamanho, "dados/%ld.bin", n);
+    }
+}
+
+/*
+    ExecutarAlgoritmo: executa um algoritmo com todas as entradas, para cada número de threads.
+
+    Parâmetros:
+        - algoritmo: algoritmo do registro
+        - entradas / num_entradas: arquivos de entrada
+        - distribuicao: rótulo da distribuição das entradas (ignorado se o algoritmo gera as
+          próprias entradas, que têm o seu rótulo)
+        - opcoes: opções da linha de comando
 
+    Funcionamento:
+        * Para cada número de threads (apenas uma vez nos algoritmos sem threads):
+        - Restaura as entradas do cache (ou as gera e as guarda no cache)
+        - Executa o algoritmo; as repetições e o aquecimento de cada arquivo são feitos pelos
+          Exec* (config_medicao), que restauram a entrada entre as execuções
+        - Verifica os arquivos após a última execução
+ */
+void ExecutarAlgoritmo(const AlgoritmoBenchmark *algoritmo, const char **entradas, int num_entradas,
+                       const char *distribuicao, const OpcoesBenchmark *opcoes)
+{
+    int num_configuracoes = algoritmo->usa_threads ? opcoes->num_threads : 1;
+
+    for (int c = 0; c < num_configuracoes; c++)
+    {
+        int num_threads = algoritmo->usa_threads ? opcoes->threads[c] : 1;
+
+        if (algoritmo->gerar_entrada)
+        {
+            distribuicao = algoritmo->gerar_entrada(opcoes->tamanhos, entradas, num_entradas, opcoes->semente);
+            GuardarEntradasCache(entradas, num_entradas);
+        }
+        else
+        {
+            RestaurarEntradas(entradas, num_entradas);
+        }
+
+        algoritmo->executar(entradas, num_entradas, num_threads, distribuicao, opcoes);
+        algoritmo->verificar(entradas, num_entradas);
+    }
+}
 
 // ============================================================
 //                  Função principal
 // ============================================================
-int main()
+int main(int argc, char **argv)
 {
-    // Define o número de threads para as versões paralelas
-    const int num_threads = 8;
+    OpcoesBenchmark opcoes;
+    int codigo;
+    if (!LerOpcoes(argc, argv, &opcoes, &codigo))
+    {
+        return codigo;
+    }
 
-    // Define o número de arquivos de entrada e seus tamanhos
-    const int num_entradas = 11;
+    if (opcoes.memoria_externo < MEMORIA_MINIMA_EXTERNO)
+    {
+        fprintf(stderr, "Memória do Merge Sort externo muito pequena: %ld bytes (mínimo %ld)\n",
+                opcoes.memoria_externo, MEMORIA_MINIMA_EXTERNO);
+        return 1;
+    }
 
-    const long tamanho_arquivos[num_entradas] = {
-        250000, 500000, 750000, 1000000,
-        2500000, 5000000, 7500000, 10000000,
-        25000000, 50000000, 100000000
-    };
+    if (opcoes.listar)
+    {
+        for (int i = 0; i < num_algoritmos_benchmark; i++)
+        {
+            printf("%-26s %s\n", algoritmos_benchmark[i].nome, algoritmos_benchmark[i].descricao);
+        }
+        return 0;
+    }
 
-    // Define os caminhos dos arquivos binários de entrada
-    const char *entradas[num_entradas] =
+    // Algoritmos escolhidos, na ordem da linha de comando (ou todos, na ordem do registro)
+    const AlgoritmoBenchmark *escolhidos[MAX_LISTA_OPCOES];
+    int num_escolhidos = 0;
+    if (opcoes.num_algoritmos == 0)
     {
-        "dados/250k.bin", "dados/500k.bin", "dados/750k.bin", "dados/1m.bin",
-        "dados/2m500.bin", "dados/5m.bin", "dados/7m500.bin", "dados/10m.bin",
-        "dados/25m.bin", "dados/50m.bin", "dados/100m.bin"
+        for (int i = 0; i < num_algoritmos_benchmark && i < MAX_LISTA_OPCOES; i++)
+        {
+            escolhidos[num_escolhidos++] = &algoritmos_benchmark[i];
+        }
+    }
+    for (int i = 0; i < opcoes.num_algoritmos; i++)
+    {
+        const AlgoritmoBenchmark *algoritmo = BuscarAlgoritmo(opcoes.algoritmos[i]);
+        if (!algoritmo)
+        {
+            fprintf(stderr, "Algoritmo desconhecido: %s (use --listar)\n", opcoes.algoritmos[i]);
+            return 1;
+        }
+        escolhidos[num_escolhidos++] = algoritmo;
+    }
+
+    // Configura a medição dos Exec*; com threads fixadas, a thread principal só é fixada
+    // (no núcleo 0) durante as regiões medidas, e as threads auxiliares ficam livres
+    config_medicao.repeticoes = opcoes.repeticoes;
+    config_medicao.aquecimento = opcoes.aquecimento;
+    config_medicao.fixar_threads = opcoes.fixar_threads;
+    config_medicao.restaurar = RestaurarEntrada;
+    config_medicao.buffers_pipeline = opcoes.buffers_pipeline;
 
-    };
+    // Fração dos modos de seleção, lida pelos seletores e pelo verificador (selecao.h)
+    fracao_selecao = opcoes.fracao_selecao;
+
+    // Os contadores são herdados apenas pelas threads criadas depois de abertos
+    if (opcoes.contadores && AbrirContadores() == 0)
+    {
+        fprintf(stderr, "Aviso: nenhum contador de desempenho disponível; as colunas ficam vazias\n");
+    }
+
+    printf("CPU: %s (%ld núcleos)\n\n", ModeloCPU(), NucleosDisponiveis());
+
+    // Define os caminhos dos arquivos binários de entrada a partir dos tamanhos
+    const int num_entradas = opcoes.num_tamanhos;
+    char caminhos[MAX_LISTA_OPCOES][64];
+    const char *entradas[MAX_LISTA_OPCOES];
+    for (int i = 0; i < num_entradas; i++)
+    {
+        NomeEntrada(opcoes.tamanhos[i], caminhos[i], sizeof(caminhos[i]));
+        entradas[i] = caminhos[i];
+    }
 
     // Cria e inicializa o arquivo CSV para registrar os tempos de execução
-    FILE *csv = fopen("results/tempos.csv", "w");
+    FILE *csv = fopen(opcoes.csv_saida, "w");
     if (!csv) {
         perror("Erro ao abrir arquivo CSV para escrita");
         return 1;
     }
-    fprintf(csv, "Algoritmo,Tamanho,Tempo\n");
+    fprintf(csv, CABECALHO_CSV_GERAL "\n");
     fclose(csv);
 
+    // Com o pipeline de E/S, o tempo total de cada lote vai para um CSV próprio
+    if (opcoes.buffers_pipeline > 0)
+    {
+        FILE *pipeline_csv = fopen(CSV_PIPELINE, "w");
+        if (!pipeline_csv) {
+            perror("Erro ao abrir arquivo CSV para escrita");
+            return 1;
+        }
+        fprintf(pipeline_csv, CABECALHO_CSV_PIPELINE "\n");
+        fclose(pipeline_csv);
+    }
+
     /*
-        Para cada algoritmo: 
-            - gera os arquivos binarios com dados aleatórios
-            - executa a ordenação
+        Para cada distribuição e cada algoritmo de int:
+            - gera os arquivos binarios com dados aleatórios na distribuição uma única vez
+              em dados/cache (apenas se algum algoritmo for executado com ela)
+            - executa a ordenação, restaurando as entradas antes de cada execução
             - verifica se os arquivos estão ordenados corretamente
     */
+    for (int d = 0; d < opcoes.num_distribuicoes; d++)
+    {
+        Distribuicao distribuicao = opcoes.distribuicoes[d];
+        bool gerado = false;
 
-    // Merge Sort Sequencial
-    GerarArquivos(tamanho_arquivos, entradas, num_entradas);
-    ExecMergeSeq(entradas, num_entradas, "results/tempos.csv");
-    VerificarOrdenado(entradas, num_entradas);
-
-    // Merge Sort com Threads (Não finalizado)
-    GerarArquivos(tamanho_arquivos, entradas, num_entradas);
-    ExecMergeThread(entradas, num_entradas, num_threads, "results/tempos.csv");
-    VerificarOrdenado(entradas,num_entradas);
-
-    // Merge Sort com CUDA (GPU)
-    GerarArquivos(tamanho_arquivos, entradas, num_entradas);
-    ExecMergeCuda(entradas, num_entradas, "results/tempos.csv");
-    VerificarOrdenado(entradas,num_entradas);
-    
-    // Radix Sort Sequencial
-    GerarArquivos(tamanho_arquivos, entradas, num_entradas);
-    ExecRadixSeq(entradas, num_entradas, "results/tempos.csv");
-    VerificarOrdenado(entradas, num_entradas);
-
-    // Radix Sort com Threads **(WIP)
-    // GerarArquivosUtils(tamanho_arquivos, entradas, num_entradas);
-    // ExecRadixThread(entradas, num_entradas, num_threads, "results/tempos.csv");
-    // VerificarOrdenado(entradas,num_entradas);   
+        for (int i = 0; i < num_escolhidos; i++)
+        {
+            const AlgoritmoBenchmark *algoritmo = escolhidos[i];
+            if (algoritmo->gerar_entrada)
+                continue;
+            if (!algoritmo->aceita_negativos && DistribuicaoTemNegativos(distribuicao))
+                continue;
 
-    // Radix Sort com CUDA (GPU) **(WIP)
-    // GerarArquivosUtils(tamanho_arquivos, entradas, num_entradas);
-    // ExecRadixCuda(entradas, num_entradas, "results/tempos.csv");
-    // VerificarOrdenado(entradas,num_entradas);
+            if (!gerado)
+            {
+                GerarEntradasCache(opcoes.tamanhos, entradas, num_entradas, distribuicao, opcoes.semente);
+                gerado = true;
+            }
+
+            ExecutarAlgoritmo(algoritmo, entradas, num_entradas, NomeDistribuicao(distribuicao), &opcoes);
+        }
+    }
+
+    // Algoritmos que geram as próprias entradas (outros tipos), independentes da distribuição
+    for (int i = 0; i < num_escolhidos; i++)
+    {
+        if (escolhidos[i]->gerar_entrada)
+        {
+            ExecutarAlgoritmo(escolhidos[i], entradas, num_entradas, NULL, &opcoes);
+        }
+    }
 
+    FecharContadores();
+    return 0;
 }
@@ -18,16 +18,75 @@
 #include <chrono>
 #include <cuda_runtime.h>
 
+#include "../../utils/arquivo_mapeado.h"
+
 #define THREADS_POR_BLOCO 256
+#define TAMANHO_BLOCO_INICIAL_CUDA 32
 
 /*
     THREADS_POR_BLOCO: número de threads por bloco CUDA quando lançamos um kernel.
         - É uma configuração de desempenho que normalmente depende da GPU.
         - não necessariamente mais threads significa mais desempenho.
+
+    TAMANHO_BLOCO_INICIAL_CUDA: número de elementos que cada thread ordena por inserção
+    antes das etapas de merge.
+        - Substitui os lançamentos de MergeKernel com sublistas de 1, 2, 4, 8 e 16 elementos,
+          cada um percorrendo o vetor inteiro na memória global.
 */ 
 
 using namespace std;
 
+// ============================================================
+//            KERNEL DE ORDENAÇÃO DOS BLOCOS INICIAIS
+// ============================================================
+
+/*
+    InsertionSortKernel: kernel CUDA em que cada thread ordena um bloco de
+    TAMANHO_BLOCO_INICIAL_CUDA elementos usando Insertion Sort.
+
+    Parâmetros:
+        - dados: ponteiro para o vetor principal (na memória do device)
+        - N: tamanho total do array (número de elementos)
+
+    Funcionamento:
+        - Cada thread copia o seu bloco para um vetor local (registradores / cache L1)
+        - Ordena o vetor local por inserção (estável)
+        - Escreve o bloco ordenado de volta em "dados"
+ */
+__global__ void InsertionSortKernel(int* dados, long N)
+{
+    long thread_id = (long)blockIdx.x * blockDim.x + threadIdx.x;
+
+    long inicio = thread_id * TAMANHO_BLOCO_INICIAL_CUDA;
+    if (inicio >= N) return;
+
+    int tamanho = TAMANHO_BLOCO_INICIAL_CUDA;
+    if (inicio + tamanho > N) tamanho = (int)(N - inicio);  // último bloco pode ser menor
+
+    int bloco[TAMANHO_BLOCO_INICIAL_CUDA];
+    for (int i = 0; i < tamanho; i++)
+    {
+        bloco[i] = dados[inicio + i];
+    }
+
+    for (int i = 1; i < tamanho; i++)
+    {
+        int valor = bloco[i];
+        int j = i - 1;
+        while (j >= 0 && bloco[j] > valor)
+        {
+            bloco[j + 1] = bloco[j];
+            j--;
+        }
+        bloco[j + 1] = valor;
+    }
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        dados[inicio + i] = bloco[i];
+    }
+}
+
 // ============================================================
 //                  KERNEL DO MERGE SORT (GPU)
 // ============================================================
@@ -51,15 +110,15 @@ using namespace std;
     Cada thread é responsável por mesclar duas sublistas adjacentes
     de tamanho "tamanho_atual" (ou menores se estivermos nas bordas).
  */
-__global__ void MergeKernel(int* dados, int* buffer_temp, int N, int tamanho_atual)
+__global__ void MergeKernel(int* dados, int* buffer_temp, long N, long tamanho_atual)
 {
     // thread_id: índice global da thread (0..num_threads-1)
-    long thread_id = blockIdx.x * blockDim.x + threadIdx.x;
+    long thread_id = (long)blockIdx.x * blockDim.x + threadIdx.x;
 
     // Calcula os índices (em elementos) das duas metades a serem mescladas:
-    long esquerda  = (long)thread_id * tamanho_atual * 2L;      // esquerda  = início da primeira metade
+    long esquerda  = thread_id * tamanho_atual * 2L;            // esquerda  = início da primeira metade
     long meio   = esquerda + tamanho_atual;                     // meio   = início da segunda metade
-    long direita = (long)(thread_id + 1) * tamanho_atual * 2L;  // direita = fim (exclusivo) da segunda metade
+    long direita = (thread_id + 1) * tamanho_atual * 2L;        // direita = fim (exclusivo) da segunda metade
 
     // Verificações de segurança para evitar acessar além do array.
     if (esquerda >= N) return;        // nada a fazer se o início estiver fora
@@ -129,20 +188,38 @@ __global__ void MergeKernel(int* dados, int* buffer_temp, int N, int tamanho_atu
         - N: tamanho do vetor
  
     Funcionamento:
-        - A ideia do merge sort bottom-up: começamos com sublistas de tamanho 1,
-        depois 2, 4, 8,... até cobrir todo o vetor. Em cada passo, lançamos
+        - Primeiro o InsertionSortKernel ordena blocos de TAMANHO_BLOCO_INICIAL_CUDA elementos.
+        - A ideia do merge sort bottom-up: começamos com sublistas do tamanho do bloco,
+        depois 2x, 4x, 8x,... até cobrir todo o vetor. Em cada passo, lançamos
         um kernel onde cada thread junta (merge) duas sublistas adjacentes de
         tamanho "N".
  */
-void MergeSortCuda(int* dados, int* buffer_temp, int N)
+void MergeSortCuda(int* dados, int* buffer_temp, long N)
 {
     if (N <= 1) 
     {
         return;
     }
 
-    // 'tamanho' é o tamanho atual das sublistas ordenadas (1,2,4,8...)
-    for (int tamanho = 1; tamanho < N; tamanho *= 2) 
+    // Ordena os blocos iniciais: uma thread por bloco de TAMANHO_BLOCO_INICIAL_CUDA elementos
+    long threads_insercao = (N + TAMANHO_BLOCO_INICIAL_CUDA - 1L) / TAMANHO_BLOCO_INICIAL_CUDA;
+    int blocos_insercao = (int)((threads_insercao + THREADS_POR_BLOCO - 1) / THREADS_POR_BLOCO);
+
+    InsertionSortKernel<<<blocos_insercao, THREADS_POR_BLOCO>>>(dados, N);
+
+    cudaError_t insercaoErr = cudaDeviceSynchronize();
+    if (insercaoErr == cudaSuccess)
+    {
+        insercaoErr = cudaGetLastError();
+    }
+    if (insercaoErr != cudaSuccess)
+    {
+        fprintf(stderr, "Erro no InsertionSortKernel: %s\n", cudaGetErrorString(insercaoErr));
+        return;
+    }
+
+    // 'tamanho' é o tamanho atual das sublistas ordenadas (32,64,128...)
+    for (long tamanho = TAMANHO_BLOCO_INICIAL_CUDA; tamanho < N; tamanho *= 2) 
     {
         // Calcula quantas threads serão usadas, cada thread faz o merge de
         // duas sublistas de tamanho "tamanho" => "tamanho*2" elementos.
@@ -160,7 +237,7 @@ void MergeSortCuda(int* dados, int* buffer_temp, int N)
         cudaError_t syncErr = cudaDeviceSynchronize();
         if (syncErr != cudaSuccess) 
         {
-            fprintf(stderr, "Erro após cudaDeviceSynchronize() na iteração tamanho=%d: %s\n", tamanho, cudaGetErrorString(syncErr));
+            fprintf(stderr, "Erro após cudaDeviceSynchronize() na iteração tamanho=%ld: %s\n", tamanho, cudaGetErrorString(syncErr));
             cudaError_t launchErr = cudaGetLastError();
             if (launchErr != cudaSuccess)
             {
@@ -174,7 +251,7 @@ void MergeSortCuda(int* dados, int* buffer_temp, int N)
         cudaError_t err = cudaGetLastError();
         if (err != cudaSuccess) 
         {
-            fprintf(stderr, "Erro no kernel após tamanho=%d: %s\n", tamanho, cudaGetErrorString(err));
+            fprintf(stderr, "Erro no kernel após tamanho=%ld: %s\n", tamanho, cudaGetErrorString(err));
             return;
         }
     }
@@ -193,7 +270,7 @@ void MergeSortCuda(int* dados, int* buffer_temp, int N)
         - dados_host: ponteiro para array de inteiros na memória do host
         - N: número de elementos no array
  */
-void HostParaDevice(int* dados_host, int N)
+void HostParaDevice(int* dados_host, long N)
 {
     int *dados_device = nullptr;
     int *buffer_device = nullptr; // ponteiros para device (GPU)
@@ -201,27 +278,27 @@ void HostParaDevice(int* dados_host, int N)
     cudaError_t err;
 
     // Aloca memória para "dados_device" na GPU com espaço para N inteiros
-    err = cudaMalloc(&dados_device, N * sizeof(int));
+    err = cudaMalloc(&dados_device, (size_t)N * sizeof(int));
     if (err != cudaSuccess) 
     {
-        fprintf(stderr, "Erro ao alocar dados_device (N=%d): %s\n", N, cudaGetErrorString(err));
+        fprintf(stderr, "Erro ao alocar dados_device (N=%ld): %s\n", N, cudaGetErrorString(err));
         return; // aborta se não conseguiu alocar
     }
 
     // Aloca memória para buffer temporário "buffer_device" na GPU
-    err = cudaMalloc(&buffer_device, N * sizeof(int));
+    err = cudaMalloc(&buffer_device, (size_t)N * sizeof(int));
     if (err != cudaSuccess) 
     {
-        fprintf(stderr, "Erro ao alocar buffer_device (N=%d): %s\n", N, cudaGetErrorString(err));
+        fprintf(stderr, "Erro ao alocar buffer_device (N=%ld): %s\n", N, cudaGetErrorString(err));
         cudaFree(dados_device);
         return;
     }
 
     // Copia dados do host (CPU) para o device (GPU)
-    err = cudaMemcpy(dados_device, dados_host, N * sizeof(int), cudaMemcpyHostToDevice);
+    err = cudaMemcpy(dados_device, dados_host, (size_t)N * sizeof(int), cudaMemcpyHostToDevice);
     if (err != cudaSuccess) 
     {
-        fprintf(stderr, "Erro em cudaMemcpy Host->Device (N=%d): %s\n", N, cudaGetErrorString(err));
+        fprintf(stderr, "Erro em cudaMemcpy Host->Device (N=%ld): %s\n", N, cudaGetErrorString(err));
         cudaFree(dados_device);
         cudaFree(buffer_device);
         return;
@@ -231,10 +308,10 @@ void HostParaDevice(int* dados_host, int N)
     MergeSortCuda(dados_device, buffer_device, N);
 
     // Copia o resultado ordenado de volta para o host
-    err = cudaMemcpy(dados_host, dados_device, N * sizeof(int), cudaMemcpyDeviceToHost);
+    err = cudaMemcpy(dados_host, dados_device, (size_t)N * sizeof(int), cudaMemcpyDeviceToHost);
     if (err != cudaSuccess)
     {
-        fprintf(stderr, "Erro em cudaMemcpy Device->Host (N=%d): %s\n", N, cudaGetErrorString(err));
+        fprintf(stderr, "Erro em cudaMemcpy Device->Host (N=%ld): %s\n", N, cudaGetErrorString(err));
     }
 
     // Libera memória alocada no device
@@ -254,81 +331,19 @@ void HostParaDevice(int* dados_host, int N)
         - entradas: array de caminhos (const char*) para arquivos binários
         - num_entradas: número de entradas no array
         - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
 
     Funcionamento:
-        - Para cada arquivo de entrada:
-        - Abre o arquivo em modo binário
-        - Determina o número de inteiros no arquivo
-        - Lê os inteiros para um vetor alocado dinamicamente
-        - Mede o tempo de ordenação chamando HostParaDevice (que usa a GPU)
-        - Regrava o arquivo com os dados ordenados
-        - Registra o tempo no arquivo CSV
-        - Usa fseek/ftell para descobrir o tamanho do arquivo (em bytes) e divide
-          por sizeof(int) para obter o número de inteiros.
-        - Lê todo o arquivo para um vetor alocado dinamicamente (new int[tamanho]).
+        - Usa ExecOrdenacaoMapeada: cada arquivo é mapeado em memória e os dados mapeados
+          são enviados à GPU, ordenados e copiados de volta por HostParaDevice
+        - O tempo de ordenação inclui as cópias entre host e device; o tempo de E/S mede
+          apenas o mapeamento do arquivo
  */
-void ExecMergeCuda(const char **entradas, int num_entradas, const char *csv_saida)
+void ExecMergeCuda(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
 {
-    FILE *csv = fopen(csv_saida, "a");
-    FILE *cuda_merge = fopen("results/cuda/merge_cuda.csv", "a");
-    if (!csv || !cuda_merge) 
-    {
-        perror("Erro ao abrir arquivos de saída CSV");
-        return;
-    }
-
-    fprintf(cuda_merge, "Tamanho,Tempo\n");
-
-    for (int i = 0; i < num_entradas; i++) 
-    {
-        FILE *file = fopen(entradas[i], "rb+"); // abre para leitura/escrita binária
-        if (!file) 
-        {
-            perror(entradas[i]);
-            return;
-        }
-
-        // Determina quantos inteiros existem no arquivo
-        fseek(file, 0, SEEK_END);
-        long tamanho = ftell(file) / sizeof(int);
-        fseek(file, 0, SEEK_SET);
-
-        int *v = new int[tamanho]; // aloca vetor no heap para os dados
-        if (fread(v, sizeof(int), tamanho, file) != (size_t)tamanho) 
-        {
-            perror("Erro ao ler o arquivo");
-            fclose(file);
-            delete[] v;
-            continue;
-        }
-
-        // Mede o tempo de ordenação usando chrono (CPU side timer)
-        auto start = chrono::high_resolution_clock::now();
-        HostParaDevice(v, tamanho); // ordena chamando a GPU
-        auto end = chrono::high_resolution_clock::now();
-        chrono::duration<double> elapsed = end - start;
-        double tempo = elapsed.count();
-
-        printf("MergeSort CUDA - Tempo para ordenar %s: %f s\n", entradas[i], tempo);
-
-        fprintf(csv, "MergeSort - CUDA,%ld,%f\n", tamanho, tempo);
-        fprintf(cuda_merge, "%ld,%f\n", tamanho, tempo);
-
-        // Regrava o arquivo com os valores ordenados (volta ao início com fseek)
-        fseek(file, 0, SEEK_SET);
-        if(fwrite(v, sizeof(int), tamanho, file) != (size_t)tamanho)
-        {
-            perror("Erro ao escrever no arquivo");
-            fclose(file);
-            delete[] v;
-            continue;
-        }
-
-        fclose(file);
-        delete[] v; // libera o vetor do host
-    }
-
-    fclose(csv);
-    fclose(cuda_merge);
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/cuda/merge_cuda.csv", "MergeSort - CUDA", 1,
+                              [](int *vetor, long tamanho, void *) { HostParaDevice(vetor, tamanho); },
+                              NULL);
 }
 
@@ -0,0 +1,668 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o Merge Sort externo (out-of-core), para arquivos maiores que a
+    memória disponível.
+    O fluxo geral é:
+        1. Ler o arquivo binário (int) em blocos (runs) que cabem no orçamento de memória
+        2. Ordenar cada run em memória com uma das ordenações existentes e gravá-la em um
+           arquivo temporário, na mesma posição que ela ocupa no arquivo de entrada
+        3. Intercalar (k-way merge) as runs com uma árvore de perdedores, lendo cada run
+           por um buffer grande e sequencial
+        4. Regravar o arquivo de entrada com os dados ordenados
+        5. Registrar tempos em CSV
+
+    Em nenhum momento o arquivo inteiro fica em memória: o consumo é limitado por
+    'memoria_bytes' (mais o buffer auxiliar da ordenação usada nas runs), o que permite ordenar
+    arquivos de centenas de GB.
+        - Runs: metade do orçamento é usada por run, deixando espaço para o buffer auxiliar
+          das ordenações com ping-pong (mesmo tamanho do vetor)
+        - Intercalação: o orçamento é dividido entre os buffers das k runs e o buffer de saída,
+          cada um com pelo menos MIN_BUFFER_EXTERNO elementos, o que limita k
+          (ViasIntercalacao). Se houver mais runs do que k, elas são intercaladas em grupos,
+          em várias passadas, até restar um grupo que é gravado no arquivo final
+        - Árvore de perdedores: escolhe o menor elemento entre k runs com log2(k) comparações,
+          sem a troca de filhos de um heap binário
+        - Todas as runs ficam em um único arquivo temporário (e as runs intercaladas de uma
+          passada intermediária em um segundo arquivo), e cada uma é lida com pread a partir
+          do seu deslocamento; assim apenas três arquivos ficam abertos, qualquer que seja o
+          número de runs
+        - Os arquivos temporários são removidos (unlink) logo após a criação e desaparecem
+          quando são fechados, mesmo se o programa for interrompido
+*/
+
+#pragma once
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../../utils/arquivo_mapeado.h"
+#include "../sequencial/merge_sort_seq.h"
+
+using namespace std;
+
+#define MAX_VIAS_EXTERNO 256
+#define MIN_BUFFER_EXTERNO (64 * 1024)
+
+/*
+    MAX_VIAS_EXTERNO: número máximo de runs intercaladas de uma vez (limita arquivos abertos
+        e mantém cada buffer de leitura grande o bastante para leituras sequenciais).
+    MIN_BUFFER_EXTERNO: tamanho mínimo (em elementos) do buffer de cada run na intercalação.
+        Orçamentos menores que MEMORIA_MINIMA_EXTERNO (uma intercalação de 2 runs) são recusados.
+*/
+
+#define MEMORIA_MINIMA_EXTERNO (3L * MIN_BUFFER_EXTERNO * (long)sizeof(int))
+
+// ============================================================
+//                  Estruturas de dados
+// ============================================================
+/*
+    Estrutura RunExterno: posição de uma run ordenada dentro de um arquivo.
+
+    Campos:
+        - inicio: índice (em elementos) do primeiro elemento da run
+        - tamanho: número de elementos da run
+ */
+struct RunExterno {
+    long inicio;
+    long tamanho;
+};
+
+/*
+    Estrutura FluxoRun: leitura sequencial e bufferizada de uma run.
+
+    Campos:
+        - fd: descritor do arquivo que contém a run
+        - buffer: bloco de elementos lidos
+        - capacidade: tamanho do buffer em elementos
+        - quantidade: número de elementos válidos no buffer
+        - posicao: índice do elemento atual no buffer
+        - proximo: índice (em elementos, no arquivo) da próxima leitura
+        - restantes: elementos da run que ainda não foram lidos do arquivo
+        - esgotado: verdadeiro quando todos os elementos da run foram consumidos
+ */
+struct FluxoRun {
+    int fd;
+    int *buffer;
+    long capacidade;
+    long quantidade;
+    long posicao;
+    long proximo;
+    long restantes;
+    bool esgotado;
+};
+
+/*
+    Estrutura EstatisticasExterno: resultados de uma ordenação externa.
+
+    Campos:
+        - elementos: número de elementos do arquivo
+        - tempo_es: tempo gasto em leituras e escritas (pread/pwrite)
+        - runs: número de runs geradas na primeira fase
+        - passadas: número de passadas de intercalação
+ */
+struct EstatisticasExterno {
+    long elementos;
+    double tempo_es;
+    long runs;
+    int passadas;
+};
+
+// ============================================================
+//             FUNÇÕES AUXILIARES DE ENTRADA/SAÍDA
+// ============================================================
+/*
+    LerBloco: lê 'quantidade' elementos a partir do elemento 'inicio' do arquivo.
+
+    Retorno:
+        - true se todos os elementos foram lidos
+
+    Funcionamento:
+        - Repete o pread até completar o bloco (leituras grandes podem voltar incompletas)
+        - Acumula o tempo gasto em 'tempo_es'
+ */
+bool LerBloco(int fd, int *buffer, long quantidade, long inicio, double *tempo_es)
+{
+    auto start = chrono::high_resolution_clock::now();
+
+    char *destino = (char *)buffer;
+    size_t bytes = (size_t)quantidade * sizeof(int);
+    off_t deslocamento = (off_t)inicio * sizeof(int);
+    while (bytes > 0)
+    {
+        ssize_t lidos = pread(fd, destino, bytes, deslocamento);
+        if (lidos <= 0)
+        {
+            break;
+        }
+        destino += lidos;
+        bytes -= lidos;
+        deslocamento += lidos;
+    }
+
+    chrono::duration<double> elapsed = chrono::high_resolution_clock::now() - start;
+    *tempo_es += elapsed.count();
+    return bytes == 0;
+}
+
+/*
+    EscreverBloco: grava 'quantidade' elementos a partir do elemento 'inicio' do arquivo,
+    da mesma forma que LerBloco (pwrite repetido, tempo acumulado em 'tempo_es').
+ */
+bool EscreverBloco(int fd, const int *buffer, long quantidade, long inicio, double *tempo_es)
+{
+    auto start = chrono::high_resolution_clock::now();
+
+    const char *origem = (const char *)buffer;
+    size_t bytes = (size_t)quantidade * sizeof(int);
+    off_t deslocamento = (off_t)inicio * sizeof(int);
+    while (bytes > 0)
+    {
+        ssize_t escritos = pwrite(fd, origem, bytes, deslocamento);
+        if (escritos <= 0)
+        {
+            break;
+        }
+        origem += escritos;
+        bytes -= escritos;
+        deslocamento += escritos;
+    }
+
+    chrono::duration<double> elapsed = chrono::high_resolution_clock::now() - start;
+    *tempo_es += elapsed.count();
+    return bytes == 0;
+}
+
+/*
+    CriarArquivoTemporario: cria um arquivo temporário em 'diretorio' para leitura e escrita.
+
+    Retorno:
+        - descritor do arquivo, ou -1 em caso de erro
+
+    Funcionamento:
+        - Cria o arquivo com mkstemp e o remove do diretório imediatamente (unlink); o espaço
+          é liberado quando o arquivo é fechado
+ */
+int CriarArquivoTemporario(const char *diretorio)
+{
+    char caminho[4096];
+    snprintf(caminho, sizeof(caminho), "%s/run_externo_XXXXXX", diretorio);
+
+    int fd = mkstemp(caminho);
+    if (fd < 0)
+    {
+        perror("Erro ao criar arquivo temporário");
+        return -1;
+    }
+    unlink(caminho);
+    return fd;
+}
+
+/*
+    AvancarFluxo: passa para o próximo elemento da run, relendo o buffer quando ele acaba.
+
+    Retorno:
+        - false em caso de erro de leitura
+ */
+bool AvancarFluxo(FluxoRun *fluxo, double *tempo_es)
+{
+    fluxo->posicao++;
+    if (fluxo->posicao < fluxo->quantidade)
+    {
+        return true;
+    }
+
+    long ler = min(fluxo->capacidade, fluxo->restantes);
+    fluxo->posicao = 0;
+    fluxo->quantidade = ler;
+    fluxo->esgotado = ler == 0;
+    if (ler == 0)
+    {
+        return true;
+    }
+
+    bool ok = LerBloco(fluxo->fd, fluxo->buffer, ler, fluxo->proximo, tempo_es);
+    fluxo->proximo += ler;
+    fluxo->restantes -= ler;
+    return ok;
+}
+
+// ============================================================
+//                  ÁRVORE DE PERDEDORES
+// ============================================================
+/*
+    MenorFluxo: verdadeiro se o elemento atual da run 'a' deve sair antes do da run 'b'.
+
+    Funcionamento:
+        - O índice k (sentinela) é menor que todos, e é usado apenas na construção da árvore
+        - Runs esgotadas são maiores que todas as outras
+        - Em caso de empate sai a run de menor índice, o que mantém a intercalação estável
+ */
+static inline bool MenorFluxo(const FluxoRun *fluxos, int k, int a, int b)
+{
+    if (a == k || b == k)
+    {
+        return a == k && b != k;
+    }
+    if (fluxos[a].esgotado || fluxos[b].esgotado)
+    {
+        return !fluxos[a].esgotado;
+    }
+
+    int valor_a = fluxos[a].buffer[fluxos[a].posicao];
+    int valor_b = fluxos[b].buffer[fluxos[b].posicao];
+    return valor_a < valor_b || (valor_a == valor_b && a < b);
+}
+
+/*
+    AjustarArvore: recoloca a run 's' na árvore de perdedores depois que o seu elemento mudou.
+
+    Parâmetros:
+        - arvore: nós internos arvore[1..k-1] guardam a run perdedora de cada disputa e
+          arvore[0] guarda a vencedora (a run com o menor elemento atual)
+        - fluxos: as k runs
+        - k: número de runs
+        - s: índice da folha (run) alterada
+
+    Funcionamento:
+        - Sobe da folha até a raiz; em cada nó a vencedora segue subindo e a perdedora fica
+          no nó, com uma comparação por nível
+ */
+void AjustarArvore(int *arvore, const FluxoRun *fluxos, int k, int s)
+{
+    for (int t = (s + k) / 2; t > 0; t /= 2)
+    {
+        if (MenorFluxo(fluxos, k, arvore[t], s))
+        {
+            int temp = arvore[t];
+            arvore[t] = s;
+            s = temp;
+        }
+    }
+    arvore[0] = s;
+}
+
+// ============================================================
+//                  INTERCALAÇÃO DAS RUNS
+// ============================================================
+/*
+    IntercalarRuns: intercala k runs ordenadas de um arquivo em uma faixa de outro arquivo.
+
+    Parâmetros:
+        - fd_entrada: arquivo que contém as runs
+        - runs: posição e tamanho de cada run
+        - k: número de runs
+        - fd_saida: arquivo de saída
+        - inicio_saida: índice (em elementos) onde a escrita começa no arquivo de saída
+        - elementos_buffer: tamanho (em elementos) do buffer de cada run e do buffer de saída
+        - tempo_es: acumulador do tempo gasto em leituras e escritas
+
+    Retorno:
+        - true em caso de sucesso
+
+    Funcionamento:
+        - Enche o buffer de cada run e constrói a árvore de perdedores com o sentinela k
+        - Repete: copia o elemento da run vencedora para o buffer de saída, avança a run e
+          reajusta a árvore, até todas as runs se esgotarem
+        - O buffer de saída é gravado inteiro sempre que enche
+ */
+bool IntercalarRuns(int fd_entrada, const RunExterno *runs, int k, int fd_saida, long inicio_saida,
+                    long elementos_buffer, double *tempo_es)
+{
+    FluxoRun *fluxos = new FluxoRun[k];
+    int *arvore = new int[k];
+    int *buffer_saida = new int[elementos_buffer];
+    bool ok = true;
+
+    for (int r = 0; r < k; r++)
+    {
+        fluxos[r].fd = fd_entrada;
+        fluxos[r].buffer = new int[elementos_buffer];
+        fluxos[r].capacidade = elementos_buffer;
+        fluxos[r].quantidade = 0;
+        fluxos[r].posicao = -1;
+        fluxos[r].proximo = runs[r].inicio;
+        fluxos[r].restantes = runs[r].tamanho;
+        ok = AvancarFluxo(&fluxos[r], tempo_es) && ok;
+    }
+
+    for (int t = 0; t < k; t++)
+    {
+        arvore[t] = k;
+    }
+    for (int r = k - 1; r >= 0; r--)
+    {
+        AjustarArvore(arvore, fluxos, k, r);
+    }
+
+    long na_saida = 0;
+    while (ok && !fluxos[arvore[0]].esgotado)
+    {
+        int vencedora = arvore[0];
+        buffer_saida[na_saida++] = fluxos[vencedora].buffer[fluxos[vencedora].posicao];
+
+        if (na_saida == elementos_buffer)
+        {
+            ok = EscreverBloco(fd_saida, buffer_saida, na_saida, inicio_saida, tempo_es);
+            inicio_saida += na_saida;
+            na_saida = 0;
+        }
+
+        ok = AvancarFluxo(&fluxos[vencedora], tempo_es) && ok;
+        AjustarArvore(arvore, fluxos, k, vencedora);
+    }
+
+    if (ok && na_saida > 0)
+    {
+        ok = EscreverBloco(fd_saida, buffer_saida, na_saida, inicio_saida, tempo_es);
+    }
+
+    for (int r = 0; r < k; r++)
+    {
+        delete[] fluxos[r].buffer;
+    }
+    delete[] fluxos;
+    delete[] arvore;
+    delete[] buffer_saida;
+
+    return ok;
+}
+
+/*
+    ViasIntercalacao: número máximo de runs intercaladas de uma vez com 'memoria_bytes' de
+    memória: os k buffers das runs e o de saída precisam de MIN_BUFFER_EXTERNO elementos cada,
+    até o limite de MAX_VIAS_EXTERNO. Orçamentos maiores ou iguais a MEMORIA_MINIMA_EXTERNO
+    permitem pelo menos 2 vias.
+ */
+int ViasIntercalacao(long memoria_bytes)
+{
+    long vias = memoria_bytes / (MIN_BUFFER_EXTERNO * (long)sizeof(int)) - 1;
+    return (int)min(vias, (long)MAX_VIAS_EXTERNO);
+}
+
+/*
+    ElementosBufferIntercalacao: tamanho do buffer de cada run ao intercalar k runs, dividindo
+    o orçamento de memória entre as k entradas e a saída (pelo menos MIN_BUFFER_EXTERNO
+    elementos quando k <= ViasIntercalacao(memoria_bytes)).
+ */
+long ElementosBufferIntercalacao(long memoria_bytes, int k)
+{
+    return memoria_bytes / ((long)(k + 1) * (long)sizeof(int));
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL MERGE SORT EXTERNO
+// ============================================================
+/*
+    MergeSortExterno: ordena no próprio lugar um arquivo binário de inteiros de qualquer
+    tamanho, usando no máximo cerca de 'memoria_bytes' de memória (pelo menos
+    MEMORIA_MINIMA_EXTERNO).
+
+    Parâmetros:
+        - caminho: arquivo binário de inteiros
+        - memoria_bytes: orçamento de memória
+        - diretorio_temp: diretório onde as runs são gravadas
+        - ordenar: ordenação em memória usada em cada run (por exemplo, MergeSortSeqPingPong)
+        - contexto: ponteiro repassado a 'ordenar'
+        - estatisticas: recebe o número de elementos, o tempo de E/S e o número de runs e
+          de passadas
+
+    Retorno:
+        - true em caso de sucesso; em caso de erro imprime a mensagem e retorna false
+
+    Funcionamento:
+        - Fase 1: lê blocos de memoria_bytes/2 bytes, ordena cada bloco e o grava no arquivo
+          temporário, na mesma posição do arquivo de entrada
+        - Fase 2: enquanto houver mais runs que ViasIntercalacao(memoria_bytes), intercala
+          grupos de runs vizinhas no outro arquivo temporário (um grupo ocupa a mesma faixa das
+          suas runs) e troca os arquivos; por fim intercala as restantes no próprio arquivo de
+          entrada
+ */
+bool MergeSortExterno(const char *caminho, long memoria_bytes, const char *diretorio_temp,
+                      FuncaoOrdenacao<int> ordenar, void *contexto, EstatisticasExterno *estatisticas)
+{
+    estatisticas->elementos = 0;
+    estatisticas->tempo_es = 0;
+    estatisticas->runs = 0;
+    estatisticas->passadas = 0;
+
+    if (memoria_bytes < MEMORIA_MINIMA_EXTERNO)
+    {
+        fprintf(stderr, "Erro: orçamento de memória do Merge Sort externo muito pequeno (%ld bytes; mínimo %ld)\n",
+                memoria_bytes, MEMORIA_MINIMA_EXTERNO);
+        return false;
+    }
+    int vias = ViasIntercalacao(memoria_bytes);
+
+    int fd = open(caminho, O_RDWR);
+    if (fd < 0)
+    {
+        perror(caminho);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        perror(caminho);
+        close(fd);
+        return false;
+    }
+
+    long tamanho = (long)(info.st_size / sizeof(int));
+    estatisticas->elementos = tamanho;
+    if (tamanho == 0)
+    {
+        close(fd);
+        return true;
+    }
+
+    long elementos_run = memoria_bytes / (2 * (long)sizeof(int));
+    long num_runs = (tamanho + elementos_run - 1) / elementos_run;
+
+    int temporarios[2] = { CriarArquivoTemporario(diretorio_temp), -1 };
+    if (num_runs > vias)
+    {
+        temporarios[1] = CriarArquivoTemporario(diretorio_temp);
+    }
+    if (temporarios[0] < 0 || (num_runs > vias && temporarios[1] < 0))
+    {
+        close(fd);
+        if (temporarios[0] >= 0)
+            close(temporarios[0]);
+        return false;
+    }
+
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    // Fase 1: geração das runs ordenadas
+    RunExterno *runs = new RunExterno[num_runs];
+    int *bloco = new int[elementos_run];
+    bool ok = true;
+
+    for (long r = 0; ok && r < num_runs; r++)
+    {
+        runs[r].inicio = r * elementos_run;
+        runs[r].tamanho = min(elementos_run, tamanho - runs[r].inicio);
+
+        ok = LerBloco(fd, bloco, runs[r].tamanho, runs[r].inicio, &estatisticas->tempo_es);
+        if (!ok)
+        {
+            perror("Erro ao ler o arquivo");
+            break;
+        }
+
+        ordenar(bloco, runs[r].tamanho, contexto);
+
+        ok = EscreverBloco(temporarios[0], bloco, runs[r].tamanho, runs[r].inicio, &estatisticas->tempo_es);
+        if (!ok)
+        {
+            perror("Erro ao gravar run");
+        }
+    }
+    delete[] bloco;
+
+    estatisticas->runs = num_runs;
+
+    // Fase 2: passadas intermediárias em grupos de até 'vias' runs
+    while (ok && num_runs > vias)
+    {
+        long novas_runs = 0;
+        for (long inicio = 0; ok && inicio < num_runs; inicio += vias)
+        {
+            int k = (int)min((long)vias, num_runs - inicio);
+
+            RunExterno intercalada;
+            intercalada.inicio = runs[inicio].inicio;
+            intercalada.tamanho = 0;
+            for (int r = 0; r < k; r++)
+            {
+                intercalada.tamanho += runs[inicio + r].tamanho;
+            }
+
+            ok = IntercalarRuns(temporarios[0], runs + inicio, k, temporarios[1], intercalada.inicio,
+                                ElementosBufferIntercalacao(memoria_bytes, k), &estatisticas->tempo_es);
+            runs[novas_runs++] = intercalada;
+        }
+
+        num_runs = novas_runs;
+        estatisticas->passadas++;
+
+        int temp = temporarios[0];
+        temporarios[0] = temporarios[1];
+        temporarios[1] = temp;
+    }
+
+    // Última passada: intercala as runs restantes no próprio arquivo de entrada
+    if (ok)
+    {
+        ok = IntercalarRuns(temporarios[0], runs, (int)num_runs, fd, 0,
+                            ElementosBufferIntercalacao(memoria_bytes, (int)num_runs), &estatisticas->tempo_es);
+        estatisticas->passadas++;
+    }
+    if (!ok)
+    {
+        perror("Erro na intercalação das runs");
+    }
+
+    delete[] runs;
+    close(temporarios[0]);
+    if (temporarios[1] >= 0)
+        close(temporarios[1]);
+    close(fd);
+
+    return ok;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecMergeExterno: executa o Merge Sort externo para múltiplos arquivos binários
+    contendo inteiros, mede os tempos e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - memoria_bytes: orçamento de memória da ordenação externa
+        - diretorio_temp: diretório onde as runs temporárias são gravadas
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        * Para cada arquivo, ExecucoesPorArquivo() vezes (config_medicao, como no
+          ExecOrdenacaoMapeada):
+        - Ordena o arquivo com MergeSortExterno, usando MergeSortSeqPingPong nas runs
+        - TempoES é o tempo gasto em pread/pwrite; Tempo é o restante (ordenação das runs e
+          intercalação)
+        * Runs e Passadas são os da última execução
+        * Os contadores de desempenho (contadores.h), se abertos, medem a ordenação externa
+          inteira, inclusive a E/S em modo usuário
+ */
+void ExecMergeExterno(const char **entradas, int num_entradas, long memoria_bytes,
+                      const char *diretorio_temp, const char *csv_saida, const char *distribuicao)
+{
+    FILE *csv = fopen(csv_saida, "a");
+    FILE *externo_merge_csv = fopen("results/externo/merge_externo.csv", "a");
+    if (!csv || !externo_merge_csv)
+    {
+        perror("Erro ao abrir arquivos de saída CSV");
+        if (csv)
+            fclose(csv);
+        if (externo_merge_csv)
+            fclose(externo_merge_csv);
+        return;
+    }
+
+    fprintf(externo_merge_csv, "Distribuicao,Threads," CABECALHO_ESTATISTICAS ",Runs,Passadas\n");
+
+    int execucoes = ExecucoesPorArquivo();
+    double *tempos = new double[execucoes];
+    double *tempos_es = new double[execucoes];
+    LeituraContadores *leituras = new LeituraContadores[execucoes];
+
+    for (int i = 0; i < num_entradas; i++)
+    {
+        EstatisticasExterno estatisticas;
+        int medidas = 0;
+
+        for (int execucao = 0; execucao < execucoes; execucao++)
+        {
+            if (execucao > 0 && !config_medicao.restaurar(entradas[i]))
+            {
+                break;
+            }
+
+            LeituraContadores leitura;
+            FixarThread(pthread_self(), 0);
+            IniciarContadores();
+            auto start = chrono::high_resolution_clock::now();
+            bool ok = MergeSortExterno(entradas[i], memoria_bytes, diretorio_temp,
+                                       [](int *vetor, long tamanho, void *) { MergeSortSeqPingPong(vetor, tamanho); },
+                                       NULL, &estatisticas);
+            auto end = chrono::high_resolution_clock::now();
+            PararContadores(&leitura);
+            LiberarThread(pthread_self());
+            if (!ok)
+            {
+                break;
+            }
+
+            if (ExecucaoRegistrada(execucao))
+            {
+                chrono::duration<double> elapsed = end - start;
+                tempos[medidas] = elapsed.count() - estatisticas.tempo_es;
+                tempos_es[medidas] = estatisticas.tempo_es;
+                leituras[medidas] = leitura;
+                medidas++;
+            }
+        }
+
+        if (medidas == 0)
+        {
+            continue;
+        }
+
+        // Colunas Runs e Passadas do CSV do algoritmo
+        char colunas_extras[64];
+        snprintf(colunas_extras, sizeof(colunas_extras), "%ld,%d", estatisticas.runs,
+                 estatisticas.passadas);
+
+        RegistrarMedicoes(csv, externo_merge_csv, "MergeSort - Externo", entradas[i], distribuicao,
+                          1, estatisticas.elementos, tempos, tempos_es, leituras, medidas,
+                          colunas_extras);
+        printf("    (%ld runs, %d passadas)\n", estatisticas.runs, estatisticas.passadas);
+    }
+
+    delete[] tempos;
+    delete[] tempos_es;
+    delete[] leituras;
+    fclose(csv);
+    fclose(externo_merge_csv);
+}
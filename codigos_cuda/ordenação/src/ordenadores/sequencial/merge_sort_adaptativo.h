@@ -0,0 +1,477 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa um Merge Sort natural e adaptativo, no estilo do TimSort com a
+    política de merges do Powersort (a mesma do TimSort do CPython a partir da versão 3.11).
+    O fluxo geral é:
+        1. Percorre o vetor da esquerda para a direita procurando runs (sequências já
+           ordenadas): crescentes, ou estritamente decrescentes, que são invertidas
+        2. Runs menores que MinRunAdaptativo(n) são estendidas até esse tamanho com
+           inserção binária
+        3. Cada run encontrada é empilhada; antes disso, as runs do topo da pilha são
+           mescladas enquanto a potência da fronteira anterior for maior que a da nova
+           fronteira (Powersort), o que mantém os merges balanceados
+        4. Os merges (MergeGalopando) usam galope: quando um lado vence várias comparações
+           seguidas, a posição em que ele perde é procurada por busca exponencial e o bloco
+           inteiro é copiado de uma vez
+        5. No final, as runs restantes na pilha são mescladas do topo para a base
+
+    O MergeSortSeq faz sempre ceil(log2(n / TAMANHO_BLOCO_INICIAL)) passadas pelo vetor
+    inteiro, mesmo que ele já esteja ordenado. Aqui um vetor ordenado (ou invertido) é uma
+    única run, ordenada em uma leitura, sem buffer auxiliar; um vetor quase ordenado tem
+    poucas runs longas e merges em que o galope copia blocos grandes, em tempo próximo do
+    linear.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../utils/arquivo_mapeado.h"
+
+#define MIN_GALOPE 7
+#define PILHA_RUNS_MAX 85
+
+/*
+    MIN_GALOPE: vitórias seguidas de um lado do merge para entrar no modo de galope (o valor
+    do TimSort). O limite usado em cada merge se adapta: diminui enquanto o galope compensa
+    e aumenta quando ele deixa de compensar.
+    PILHA_RUNS_MAX: tamanho da pilha de runs. No Powersort as potências da pilha são
+    estritamente crescentes e limitadas pelo número de bits de n, o que limita a pilha.
+*/
+
+// ============================================================
+//                  DETECÇÃO E EXTENSÃO DAS RUNS
+// ============================================================
+/*
+    MinRunAdaptativo: tamanho mínimo das runs para 'n' elementos (o mesmo do TimSort).
+
+    Funcionamento:
+        - Usa os 6 bits mais significativos de n, somando 1 se algum dos bits restantes
+          estiver ligado: o resultado fica entre 32 e 64 e n / min_run fica logo abaixo de
+          uma potência de 2, o que equilibra os merges das runs estendidas
+ */
+long MinRunAdaptativo(long n)
+{
+    long resto = 0;
+    while (n >= 64)
+    {
+        resto |= n & 1;
+        n >>= 1;
+    }
+    return n + resto;
+}
+
+/*
+    ContarRun: tamanho da run que começa em vetor[inicio].
+
+    Funcionamento:
+        - Uma run crescente aceita elementos iguais (vetor[i] <= vetor[i + 1])
+        - Uma run decrescente precisa ser estritamente decrescente, e é invertida no próprio
+          lugar: com elementos iguais a inversão trocaria a ordem deles (perderia a estabilidade)
+ */
+long ContarRun(int *vetor, long inicio, long n)
+{
+    long fim = inicio + 1;
+    if (fim == n)
+    {
+        return 1;
+    }
+
+    if (vetor[fim] < vetor[inicio])
+    {
+        while (fim + 1 < n && vetor[fim + 1] < vetor[fim])
+            fim++;
+        fim++;
+
+        for (long esq = inicio, dir = fim - 1; esq < dir; esq++, dir--)
+        {
+            int temp = vetor[esq];
+            vetor[esq] = vetor[dir];
+            vetor[dir] = temp;
+        }
+    }
+    else
+    {
+        while (fim + 1 < n && vetor[fim + 1] >= vetor[fim])
+            fim++;
+        fim++;
+    }
+
+    return fim - inicio;
+}
+
+/*
+    InsercaoBinaria: ordena [inicio, fim) sabendo que [inicio, ordenados) já está ordenado.
+
+    Funcionamento:
+        - Cada novo elemento é inserido depois dos elementos menores ou iguais (busca binária
+          da última posição válida, o que mantém a estabilidade), deslocando os maiores
+        - Faz O(log run) comparações por elemento; os deslocamentos são memmove de poucos
+          elementos, já que as runs estendidas têm no máximo 64 elementos
+ */
+void InsercaoBinaria(int *vetor, long inicio, long fim, long ordenados)
+{
+    for (long i = ordenados; i < fim; i++)
+    {
+        int valor = vetor[i];
+        long esq = inicio, dir = i;
+        while (esq < dir)
+        {
+            long meio = esq + (dir - esq) / 2;
+            if (valor < vetor[meio])
+                dir = meio;
+            else
+                esq = meio + 1;
+        }
+
+        memmove(&vetor[esq + 1], &vetor[esq], (i - esq) * sizeof(int));
+        vetor[esq] = valor;
+    }
+}
+
+// ============================================================
+//                  GALOPE (BUSCA EXPONENCIAL)
+// ============================================================
+/*
+    GalopeDireita: número de elementos de a[0..n) menores ou iguais a 'chave' (a posição mais à
+    direita em que 'chave' pode ser inserida).
+
+    Funcionamento:
+        - Busca exponencial a partir do início (posições 0, 1, 3, 7, ...) até passar da chave,
+          seguida de busca binária no último intervalo: O(log k) comparações para a resposta k
+ */
+long GalopeDireita(int chave, const int *a, long n)
+{
+    long anterior = 0, limite = 1;
+    while (limite < n && a[limite - 1] <= chave)
+    {
+        anterior = limite;
+        limite = 2 * limite + 1;
+    }
+    if (limite > n)
+        limite = n;
+
+    // A resposta está em [anterior, limite]
+    while (anterior < limite)
+    {
+        long meio = anterior + (limite - anterior) / 2;
+        if (a[meio] <= chave)
+            anterior = meio + 1;
+        else
+            limite = meio;
+    }
+    return anterior;
+}
+
+/*
+    GalopeEsquerda: número de elementos de a[0..n) estritamente menores que 'chave' (a posição
+    mais à esquerda em que 'chave' pode ser inserida).
+ */
+long GalopeEsquerda(int chave, const int *a, long n)
+{
+    long anterior = 0, limite = 1;
+    while (limite < n && a[limite - 1] < chave)
+    {
+        anterior = limite;
+        limite = 2 * limite + 1;
+    }
+    if (limite > n)
+        limite = n;
+
+    while (anterior < limite)
+    {
+        long meio = anterior + (limite - anterior) / 2;
+        if (a[meio] < chave)
+            anterior = meio + 1;
+        else
+            limite = meio;
+    }
+    return anterior;
+}
+
+// ============================================================
+//                  FUNÇÃO DE MESCLAGEM COM GALOPE
+// ============================================================
+/*
+    MergeGalopando: mescla as runs adjacentes [começo, meio) e [meio, fim) do vetor.
+
+    Parâmetros:
+        - vetor: vetor com as duas runs ordenadas
+        - começo, meio, fim: limites das runs
+        - auxiliar: buffer com espaço para a run da esquerda
+        - min_galope: limite atual de vitórias seguidas para entrar no galope (atualizado)
+
+    Funcionamento:
+        - Antes do merge, os elementos da esquerda menores ou iguais ao primeiro da direita,
+          e os da direita maiores ou iguais ao último da esquerda, já estão no lugar e são
+          descartados (com galope); runs que já estão em ordem entre si nem são copiadas
+        - Copia o que restou da run da esquerda para o auxiliar e mescla no vetor, da
+          esquerda para a direita; a run da direita é lida no próprio vetor, sempre à frente
+          da posição de escrita
+        - Modo normal: um elemento por vez, contando as vitórias seguidas de cada lado.
+          Nos empates vence a esquerda, o que mantém a estabilidade
+        - Modo de galope: depois de min_galope vitórias seguidas, alterna GalopeDireita (quantos
+          da esquerda vêm antes do próximo da direita) e GalopeEsquerda (quantos da direita vêm
+          antes do próximo da esquerda), copiando os blocos com memcpy/memmove. Sai quando os
+          dois blocos ficam menores que MIN_GALOPE
+ */
+void MergeGalopando(int *vetor, long começo, long meio, long fim, int *auxiliar, int *min_galope)
+{
+    // Descarta o início da esquerda e o final da direita, que já estão no lugar
+    começo += GalopeDireita(vetor[meio], &vetor[começo], meio - começo);
+    if (começo == meio)
+    {
+        return;
+    }
+    fim = meio + GalopeEsquerda(vetor[meio - 1], &vetor[meio], fim - meio);
+    if (fim == meio)
+    {
+        return;
+    }
+
+    long na = meio - começo;
+    long nb = fim - meio;
+    memcpy(auxiliar, &vetor[começo], na * sizeof(int));
+
+    const int *a = auxiliar;
+    const int *b = &vetor[meio];
+    int *destino = &vetor[começo];
+    int limite = *min_galope;
+
+    while (na > 0 && nb > 0)
+    {
+        // Modo normal: um elemento por vez
+        long vitorias_a = 0, vitorias_b = 0;
+        while (na > 0 && nb > 0 && vitorias_a < limite && vitorias_b < limite)
+        {
+            if (*b < *a)
+            {
+                *destino++ = *b++;
+                nb--;
+                vitorias_b++;
+                vitorias_a = 0;
+            }
+            else
+            {
+                *destino++ = *a++;
+                na--;
+                vitorias_a++;
+                vitorias_b = 0;
+            }
+        }
+
+        // Modo de galope: blocos inteiros de cada lado
+        long bloco_a = MIN_GALOPE, bloco_b = MIN_GALOPE;
+        while (na > 0 && nb > 0 && (bloco_a >= MIN_GALOPE || bloco_b >= MIN_GALOPE))
+        {
+            if (limite > 1)
+                limite--;
+
+            bloco_a = GalopeDireita(*b, a, na);
+            memcpy(destino, a, bloco_a * sizeof(int));
+            destino += bloco_a;
+            a += bloco_a;
+            na -= bloco_a;
+            if (na == 0)
+                break;
+
+            *destino++ = *b++;
+            nb--;
+            if (nb == 0)
+                break;
+
+            bloco_b = GalopeEsquerda(*a, b, nb);
+            memmove(destino, b, bloco_b * sizeof(int));
+            destino += bloco_b;
+            b += bloco_b;
+            nb -= bloco_b;
+            if (nb == 0)
+                break;
+
+            *destino++ = *a++;
+            na--;
+        }
+
+        // Penaliza a saída do galope, para não voltar a ele logo em seguida
+        limite += 2;
+    }
+
+    // O que sobrou da direita já está no lugar; o que sobrou da esquerda vai para o final
+    memcpy(destino, a, na * sizeof(int));
+
+    *min_galope = limite;
+}
+
+// ============================================================
+//                  POLÍTICA DE MERGES (POWERSORT)
+// ============================================================
+/*
+    Estrutura RunAdaptativa: run na pilha do MergeSortAdaptativo.
+
+    Campos:
+        - inicio, tamanho: posição e tamanho da run no vetor
+        - potencia: potência da fronteira entre esta run e a seguinte (PotenciaFronteira)
+ */
+struct RunAdaptativa {
+    long inicio;
+    long tamanho;
+    int potencia;
+};
+
+/*
+    PotenciaFronteira: potência da fronteira entre as runs adjacentes [inicio, inicio + n1) e
+    [inicio + n1, inicio + n1 + n2) de um vetor com 'n' elementos.
+
+    Funcionamento:
+        - Os pontos médios das duas runs, divididos por n, são números em [0, 1); a potência
+          é a posição do primeiro bit em que as suas expansões binárias diferem
+        - Fronteiras de potência pequena ficam perto do meio do vetor (são mescladas por
+          último), como os níveis de um Merge Sort top-down; é o que deixa os merges
+          balanceados mesmo com runs de tamanhos muito diferentes
+        - Calculada só com inteiros: a e b são os dobros dos pontos médios
+ */
+int PotenciaFronteira(long inicio, long n1, long n2, long n)
+{
+    int potencia = 0;
+    unsigned long a = 2 * (unsigned long)inicio + n1;
+    unsigned long b = a + n1 + n2;
+    unsigned long total = (unsigned long)n;
+
+    while (true)
+    {
+        potencia++;
+        if (a >= total)
+        {
+            // Os dois bits são 1
+            a -= total;
+            b -= total;
+        }
+        else if (b >= total)
+        {
+            // Os bits diferem
+            break;
+        }
+        a <<= 1;
+        b <<= 1;
+    }
+    return potencia;
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL MERGE SORT ADAPTATIVO
+// ============================================================
+/*
+    MergeSortAdaptativo: ordena um vetor de inteiros com o Merge Sort natural adaptativo.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - n: número de elementos no array
+
+    Funcionamento:
+        - Encontra as runs (ContarRun), estendendo as curtas até MinRunAdaptativo(n) elementos
+          com InsercaoBinaria
+        - Ao encontrar uma nova run, calcula a potência da fronteira com a run do topo da pilha
+          e mescla as duas runs do topo enquanto a fronteira entre elas tiver potência maior;
+          depois empilha a nova run
+        - No final mescla as runs restantes, do topo para a base
+        - O buffer auxiliar (n elementos, pois a run da esquerda pode ter quase todo o vetor)
+          é alocado apenas no primeiro merge; um vetor que já é uma única run não aloca nada
+        - Estável: runs decrescentes são estritas, a inserção binária e os merges mantêm a
+          ordem dos iguais
+ */
+void MergeSortAdaptativo(int *vetor, long n)
+{
+    if (n < 2)
+    {
+        return;
+    }
+
+    long min_run = MinRunAdaptativo(n);
+    RunAdaptativa pilha[PILHA_RUNS_MAX];
+    int num_runs = 0;
+    int *auxiliar = NULL;
+    int min_galope = MIN_GALOPE;
+
+    long inicio = 0;
+    while (inicio < n)
+    {
+        long tamanho = ContarRun(vetor, inicio, n);
+        if (tamanho < min_run)
+        {
+            long estendido = min_run < n - inicio ? min_run : n - inicio;
+            InsercaoBinaria(vetor, inicio, inicio + estendido, inicio + tamanho);
+            tamanho = estendido;
+        }
+
+        if (num_runs > 0)
+        {
+            RunAdaptativa *topo = &pilha[num_runs - 1];
+            int potencia = PotenciaFronteira(topo->inicio, topo->tamanho, tamanho, n);
+
+            while (num_runs > 1 && pilha[num_runs - 2].potencia > potencia)
+            {
+                RunAdaptativa *esquerda = &pilha[num_runs - 2];
+                RunAdaptativa *direita = &pilha[num_runs - 1];
+                if (!auxiliar)
+                    auxiliar = new int[n];
+
+                MergeGalopando(vetor, esquerda->inicio, direita->inicio, direita->inicio + direita->tamanho,
+                               auxiliar, &min_galope);
+                esquerda->tamanho += direita->tamanho;
+                num_runs--;
+            }
+
+            pilha[num_runs - 1].potencia = potencia;
+        }
+
+        pilha[num_runs].inicio = inicio;
+        pilha[num_runs].tamanho = tamanho;
+        pilha[num_runs].potencia = 0;
+        num_runs++;
+
+        inicio += tamanho;
+    }
+
+    while (num_runs > 1)
+    {
+        RunAdaptativa *esquerda = &pilha[num_runs - 2];
+        RunAdaptativa *direita = &pilha[num_runs - 1];
+        if (!auxiliar)
+            auxiliar = new int[n];
+
+        MergeGalopando(vetor, esquerda->inicio, direita->inicio, direita->inicio + direita->tamanho,
+                       auxiliar, &min_galope);
+        esquerda->tamanho += direita->tamanho;
+        num_runs--;
+    }
+
+    delete[] auxiliar;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecMergeAdaptativo: executa o Merge Sort adaptativo para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com MergeSortAdaptativo
+ */
+void ExecMergeAdaptativo(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/merge_adaptativo.csv", "MergeSort - Adaptativo (runs naturais)", 1,
+                              [](int *vetor, long tamanho, void *) { MergeSortAdaptativo(vetor, tamanho); },
+                              NULL);
+}
@@ -13,17 +13,146 @@
     O Merge Sort é um algoritmo de ordenação baseado na técnica "dividir para conquistar".
     Ele divide o vetor em subvetores, ordena cada subvetor e depois mescla (merge) os resultados.
     Esta implementação utiliza a versão iterativa (bottom-up), que evita chamadas recursivas.
+
+    Antes das passadas de merge, blocos de TAMANHO_BLOCO_INICIAL elementos são ordenados por
+    inserção, e as passadas começam a partir desse tamanho em vez de subvetores de 1 elemento.
+
+    Há também a versão MergeSortSeqPingPong, que aloca um único buffer auxiliar de tamanho n
+    no início e alterna origem e destino a cada passada, sem alocações nem cópias por merge.
+
+    As variantes chave-valor (MergeSortRegistros, MergeSortRegistrosSoA) usam a mesma inserção
+    e o mesmo esquema ping-pong, por meio de vistas (VistaVetor, VistaSoA) que movem a carga de
+    cada registro junto com a chave (registros.h), e ArgsortMerge devolve a permutação que
+    ordena um vetor de chaves.
 */
 
+#pragma once
+
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <chrono>
 
+#include "../../utils/arquivo_mapeado.h"
+#include "../../utils/registros.h"
+
 using namespace std;
 
+#define TAMANHO_BLOCO_INICIAL 32
+
+/*
+    TAMANHO_BLOCO_INICIAL: tamanho dos blocos ordenados por inserção antes das passadas de merge.
+        - Evita as primeiras passadas (subvetores de 1, 2, 4, 8 e 16 elementos), que percorrem
+          o vetor inteiro na memória para fazer pouco trabalho cada uma.
+        - Um bloco de 32 ints (128 bytes) é ordenado inteiramente dentro da cache L1.
+*/
+
+// ============================================================
+//                  ACESSO AOS ELEMENTOS
+// ============================================================
+/*
+    Vistas: as funções de inserção e de merge abaixo são templates sobre uma vista, que dá
+    acesso aos elementos pela posição, para que inteiros e registros nos layouts AoS e SoA
+    usem o mesmo código. Uma vista define:
+        - Elemento: tipo copiado para um temporário (na inserção) ou entre vetores (no merge)
+        - Ler(i) / Gravar(i, elemento): lê e grava o elemento da posição i
+        - Chave(i) / ChaveDe(elemento): chave de ordenação da posição i e de um elemento lido
+ */
+
+/*
+    ChaveDoElemento: chave de ordenação de um elemento de um vetor: o próprio valor, ou a chave
+    de um Registro.
+ */
+template <typename T>
+T ChaveDoElemento(const T &valor)
+{
+    return valor;
+}
+
+template <typename K, typename P>
+K ChaveDoElemento(const Registro<K, P> &registro)
+{
+    return registro.chave;
+}
 
+/*
+    VistaVetor<T>: vista de um vetor de T (int, ou Registro no layout AoS).
+ */
+template <typename T>
+struct VistaVetor {
+    typedef T Elemento;
+    T *dados;
+
+    VistaVetor(T *dados) : dados(dados) {}
+    const T &Ler(long i) const { return dados[i]; }
+    void Gravar(long i, const T &elemento) const { dados[i] = elemento; }
+    auto Chave(long i) const -> decltype(ChaveDoElemento(dados[i])) { return ChaveDoElemento(dados[i]); }
+    static auto ChaveDe(const T &elemento) -> decltype(ChaveDoElemento(elemento)) { return ChaveDoElemento(elemento); }
+};
+
+/*
+    VistaSoA<K, P>: vista de registros no layout SoA (vetor de chaves e vetor de cargas).
+        - O Elemento é um Registro montado com a chave e a carga da posição; as comparações
+          leem apenas o vetor das chaves
+ */
+template <typename K, typename P>
+struct VistaSoA {
+    typedef Registro<K, P> Elemento;
+    K *chaves;
+    P *cargas;
+
+    VistaSoA(K *chaves, P *cargas) : chaves(chaves), cargas(cargas) {}
+    Elemento Ler(long i) const { return Elemento{chaves[i], cargas[i]}; }
+    void Gravar(long i, const Elemento &elemento) const
+    {
+        chaves[i] = elemento.chave;
+        cargas[i] = elemento.carga;
+    }
+    K Chave(long i) const { return chaves[i]; }
+    static K ChaveDe(const Elemento &elemento) { return elemento.chave; }
+};
+
+// ============================================================
+//           FUNÇÃO DE ORDENAÇÃO DOS BLOCOS INICIAIS
+// ============================================================
+/*
+    InsertionSortSeq: ordena o intervalo [começo, fim) da vista usando Insertion Sort.
+
+    Parâmetros:
+        - vista: acesso aos elementos (VistaVetor ou VistaSoA)
+        - começo: índice inicial do intervalo
+        - fim: índice final (exclusivo) do intervalo
+
+    Funcionamento:
+        - Cada elemento é deslocado para a esquerda até encontrar um elemento menor ou igual,
+          o que mantém a ordenação estável
+        - Eficiente para intervalos pequenos, como os blocos de TAMANHO_BLOCO_INICIAL elementos
+ */
+template <typename V>
+void InsertionSortSeq(V vista, long começo, long fim)
+{
+    for(long i = começo + 1; i < fim; i++)
+    {
+        typename V::Elemento valor = vista.Ler(i);
+        long j = i - 1;
+        while(j >= começo && vista.Chave(j) > V::ChaveDe(valor))
+        {
+            vista.Gravar(j + 1, vista.Ler(j));
+            j--;
+        }
+        vista.Gravar(j + 1, valor);
+    }
+}
+
+/*
+    InsertionSortSeq: versão para um vetor de inteiros.
+ */
+void InsertionSortSeq(int *vetor, long começo, long fim)
+{
+    InsertionSortSeq(VistaVetor<int>(vetor), começo, fim);
+}
 
 // ============================================================
 //                  FUNÇÃO DE MESCLAGEM (MERGE)
@@ -43,23 +172,23 @@ using namespace std;
         - Mescla os dois subvetores de volta ao vetor principal, mantendo a ordem
         - Garante estabilidade na ordenação
  */
-void MergeSeq(int *vetor, int começo, int meio, int fim)
+void MergeSeq(int *vetor, long começo, long meio, long fim)
 {
-    int tam_esquerda = meio - começo + 1;
-    int tam_direita = fim - meio;
+    long tam_esquerda = meio - começo + 1;
+    long tam_direita = fim - meio;
 
     int *vet_esq = new int[tam_esquerda];
     int *vet_dir = new int[tam_direita];
 
     // Copia elementos para os vetores auxiliares
-    int idx_esq = 0;
+    long idx_esq = 0;
     while(idx_esq < tam_esquerda)
     {
         vet_esq[idx_esq] = vetor[começo + idx_esq];
         idx_esq++;
     }
     
-    int idx_dir = 0;
+    long idx_dir = 0;
     while(idx_dir < tam_direita)
     {
         vet_dir[idx_dir] = vetor[meio + 1 + idx_dir];
@@ -69,7 +198,7 @@ void MergeSeq(int *vetor, int começo, int meio, int fim)
     // Mescla os vetores auxiliares de volta ao vetor principal
     idx_esq = 0;
     idx_dir = 0;
-    int idx = começo;
+    long idx = começo;
     while(idx_esq < tam_esquerda && idx_dir < tam_direita)
     {
         if(vet_esq[idx_esq] <= vet_dir[idx_dir])
@@ -113,21 +242,27 @@ void MergeSeq(int *vetor, int começo, int meio, int fim)
         - n: número de elementos no array
 
     Funcionamento:
-        - Começa com subvetores de tamanho 1 e vai dobrando o tamanho a cada iteração
+        - Ordena blocos de TAMANHO_BLOCO_INICIAL elementos com InsertionSortSeq
+        - Começa com subvetores do tamanho do bloco e vai dobrando o tamanho a cada iteração
         - Para cada par de subvetores adjacentes, chama MergeSeq para mesclar
         - Repete até que todo o vetor esteja ordenado
  */
-void MergeSortSeq(int *vetor, int n)
+void MergeSortSeq(int *vetor, long n)
 {
-    int tamanho = 1;
+    for(long inicio = 0; inicio < n; inicio += TAMANHO_BLOCO_INICIAL)
+    {
+        InsertionSortSeq(vetor, inicio, min(inicio + TAMANHO_BLOCO_INICIAL, n));
+    }
+
+    long tamanho = TAMANHO_BLOCO_INICIAL;
     while(tamanho < n)
     {
-        int inicio = 0;
+        long inicio = 0;
         while(inicio < n - 1)
         {
-            int começo = inicio;
-            int meio = min(inicio + tamanho - 1, n - 1);
-            int fim = min(inicio + 2 * tamanho - 1, n - 1);
+            long começo = inicio;
+            long meio = min(inicio + tamanho - 1, n - 1);
+            long fim = min(inicio + 2 * tamanho - 1, n - 1);
             
             if(meio < fim)
                 MergeSeq(vetor, começo, meio, fim);
@@ -140,88 +275,386 @@ void MergeSortSeq(int *vetor, int n)
 }
 
 // ============================================================
-//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+//          MERGE SORT COM BUFFER PING-PONG (SEM ALOCAÇÕES)
 // ============================================================
 /*
-    ExecMergeSeq: executa o Merge Sort sequencial para múltiplos arquivos binários
-    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+    MergeSeqPingPong: mescla dois subvetores adjacentes já ordenados de 'origem' no
+    mesmo intervalo de 'destino'.
 
     Parâmetros:
-        - entradas: array de caminhos (const char*) para arquivos binários
-        - num_entradas: número de entradas no array
-        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - origem: vista com os subvetores ordenados [começo, meio) e [meio, fim)
+        - destino: vista que recebe o intervalo [começo, fim) mesclado
+        - começo: índice inicial do primeiro subvetor
+        - meio: índice inicial do segundo subvetor (fim exclusivo do primeiro)
+        - fim: índice final exclusivo do segundo subvetor
 
     Funcionamento:
-        * Para cada arquivo:
-        - Abre o arquivo e determina o número de inteiros
-        - Lê os dados para um vetor alocado dinamicamente
-        - Mede o tempo de ordenação usando chrono
-        - Ordena os dados com MergeSortSeq
-        - Registra o tempo no arquivo CSV
-        - Regrava o arquivo com os dados ordenados
-        - Libera memória utilizada
- */
-void ExecMergeSeq(const char **entradas, int num_entradas, const char *csv_saida)
-{
-    FILE *csv = fopen(csv_saida, "a");
-    FILE *seq_merge_csv = fopen("results/sequencial/merge_seq.csv", "a");
-    if (!csv || !seq_merge_csv)
-    {
-        perror("Erro ao abrir arquivos de saída CSV");
-        return;
+        - Igual ao MergeSeq, mas lê diretamente da origem e escreve no destino,
+          sem vetores auxiliares e sem copiar o resultado de volta
+        - Garante estabilidade na ordenação
+ */
+template <typename VO, typename VD>
+void MergeSeqPingPong(VO origem, VD destino, long começo, long meio, long fim)
+{
+    long idx_esq = começo;
+    long idx_dir = meio;
+    long idx = começo;
+
+    while(idx_esq < meio && idx_dir < fim)
+    {
+        if(origem.Chave(idx_esq) <= origem.Chave(idx_dir))
+        {
+            destino.Gravar(idx++, origem.Ler(idx_esq++));
+        } else {
+            destino.Gravar(idx++, origem.Ler(idx_dir++));
+        }
     }
 
-    fprintf(seq_merge_csv, "Tamanho,Tempo\n");
+    // Copia o restante dos elementos, se houver
+    while(idx_esq < meio)
+    {
+        destino.Gravar(idx++, origem.Ler(idx_esq++));
+    }
 
-    for (int i = 0; i < num_entradas; i++)
+    while(idx_dir < fim)
     {
-        FILE *file = fopen(entradas[i], "rb+"); // abre para leitura/escrita binária
+        destino.Gravar(idx++, origem.Ler(idx_dir++));
+    }
+}
 
-        if(!file)
-        {
-            perror(entradas[i]);
-            return;
-        }
+/*
+    MergeSeqPingPong: versão para vetores de inteiros (também usada como FuncaoMerge escalar
+    pelo merge_sort_simd.h).
+ */
+void MergeSeqPingPong(const int *origem, int *destino, long começo, long meio, long fim)
+{
+    MergeSeqPingPong(VistaVetor<const int>(origem), VistaVetor<int>(destino), começo, meio, fim);
+}
 
-        fseek(file, 0, SEEK_END);
-        long tamanho = ftell(file) / sizeof(int);
-        fseek(file, 0, SEEK_SET);
+/*
+    MergeSortSeqPingPongBuffer: ordena uma vista usando o Merge Sort bottom-up, alternando
+    entre ela e uma vista auxiliar fornecida pelo chamador.
 
-        int *vetor = new int[tamanho];
+    Parâmetros:
+        - vetor: vista dos elementos a serem ordenados
+        - auxiliar: vista com espaço para n elementos (seu conteúdo é descartado)
+        - n: número de elementos
 
-        if(fread(vetor, sizeof(int), tamanho, file) != (size_t)tamanho)
+    Retorno:
+        - a vista (vetor ou auxiliar) que contém o resultado ordenado
+
+    Funcionamento:
+        - Ordena blocos de TAMANHO_BLOCO_INICIAL elementos com InsertionSortSeq
+        - Em cada passada, mescla todos os pares de subvetores da origem no destino
+          (um subvetor sem par no final é apenas copiado) e troca origem e destino
+ */
+template <typename V>
+V MergeSortSeqPingPongBuffer(V vetor, V auxiliar, long n)
+{
+    for(long inicio = 0; inicio < n; inicio += TAMANHO_BLOCO_INICIAL)
+    {
+        InsertionSortSeq(vetor, inicio, min(inicio + (long)TAMANHO_BLOCO_INICIAL, n));
+    }
+
+    V origem = vetor;
+    V destino = auxiliar;
+
+    for(long tamanho = TAMANHO_BLOCO_INICIAL; tamanho < n; tamanho *= 2)
+    {
+        for(long começo = 0; começo < n; começo += 2 * tamanho)
         {
-            perror("Erro ao ler o arquivo");
-            fclose(file);
-            delete[] vetor;
-            continue;
+            long meio = min(começo + tamanho, n);
+            long fim = min(começo + 2 * tamanho, n);
+
+            MergeSeqPingPong(origem, destino, começo, meio, fim);
         }
 
-        auto start = chrono::high_resolution_clock::now();
-        MergeSortSeq(vetor, tamanho);
-        auto end = chrono::high_resolution_clock::now();
+        V temp = origem;
+        origem = destino;
+        destino = temp;
+    }
 
-        chrono::duration<double> elapsed = end - start;
-        double tempo = elapsed.count();
+    return origem;
+}
 
-        printf("Merge Sort Sequencial - Tempo para ordenar %s: %f s\n", entradas[i], tempo);
+/*
+    MergeSortSeqPingPongBuffer: versão para vetores de inteiros; retorna o ponteiro (vetor ou
+    auxiliar) que contém o resultado ordenado.
+ */
+int *MergeSortSeqPingPongBuffer(int *vetor, int *auxiliar, long n)
+{
+    return MergeSortSeqPingPongBuffer(VistaVetor<int>(vetor), VistaVetor<int>(auxiliar), n).dados;
+}
 
-        fprintf(csv, "MergeSort - Sequencial,%ld,%f\n", tamanho, tempo);
-        fprintf(seq_merge_csv, "%ld,%f\n", tamanho, tempo);
+/*
+    MergeSortSeqPingPong: ordena um vetor de inteiros usando o Merge Sort bottom-up com um
+    único buffer auxiliar alocado no início.
 
-        fseek(file, 0, SEEK_SET);
-        if(fwrite(vetor, sizeof(int), tamanho, file) != (size_t)tamanho)
-        {
-            perror("Erro ao escrever no arquivo");
-            fclose(file);
-            delete[] vetor;
-            continue;
-        }    
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - n: número de elementos no array
 
-        fclose(file);
-        delete[] vetor;
+    Funcionamento:
+        - Aloca o buffer auxiliar de tamanho n uma única vez
+        - Ordena com MergeSortSeqPingPongBuffer
+        - Se o resultado final ficou no buffer auxiliar, copia de volta para o vetor
+ */
+void MergeSortSeqPingPong(int *vetor, long n)
+{
+    if(n <= 1)
+    {
+        return;
+    }
+
+    int *auxiliar = new int[n];
+    int *resultado = MergeSortSeqPingPongBuffer(vetor, auxiliar, n);
+
+    if(resultado != vetor)
+    {
+        memcpy(vetor, resultado, n * sizeof(int));
     }
 
-    fclose(csv);
-    fclose(seq_merge_csv);
-}
\ No newline at end of file
+    delete[] auxiliar;
+}
+
+// ============================================================
+//          MERGE SORT DE REGISTROS (CHAVE-VALOR)
+// ============================================================
+/*
+    MergeSortRegistros: ordena um vetor de registros (layout AoS) pela chave, com o Merge Sort
+    bottom-up com buffer ping-pong.
+
+    Parâmetros:
+        - vetor: registros a serem ordenados
+        - n: número de registros
+
+    Funcionamento:
+        - MergeSortSeqPingPongBuffer sobre VistaVetor<Registro>: compara apenas as chaves e
+          move o registro inteiro (chave e carga)
+        - Estável: nos empates a inserção não passa do registro igual e o merge escolhe o
+          registro da esquerda, que veio antes
+ */
+template <typename K, typename P>
+void MergeSortRegistros(Registro<K, P> *vetor, long n)
+{
+    typedef Registro<K, P> R;
+
+    if (n <= 1)
+    {
+        return;
+    }
+
+    R *auxiliar = new R[n];
+    R *resultado = MergeSortSeqPingPongBuffer(VistaVetor<R>(vetor), VistaVetor<R>(auxiliar), n).dados;
+
+    if (resultado != vetor)
+    {
+        memcpy(vetor, resultado, n * sizeof(R));
+    }
+
+    delete[] auxiliar;
+}
+
+/*
+    MergeSortRegistrosSoA: ordena registros no layout SoA (vetor de chaves e vetor de cargas)
+    pela chave, com o Merge Sort bottom-up com buffer ping-pong.
+
+    Parâmetros:
+        - chaves: vetor das chaves
+        - cargas: vetor das cargas; cargas[i] é a carga de chaves[i]
+        - n: número de registros
+
+    Funcionamento:
+        - MergeSortSeqPingPongBuffer sobre VistaSoA, com um buffer auxiliar para as chaves e
+          outro para as cargas; as comparações leem apenas o vetor das chaves
+        - Estável, como o MergeSortRegistros
+ */
+template <typename K, typename P>
+void MergeSortRegistrosSoA(K *chaves, P *cargas, long n)
+{
+    if (n <= 1)
+    {
+        return;
+    }
+
+    K *chaves_aux = new K[n];
+    P *cargas_aux = new P[n];
+    VistaSoA<K, P> resultado = MergeSortSeqPingPongBuffer(VistaSoA<K, P>(chaves, cargas),
+                                                          VistaSoA<K, P>(chaves_aux, cargas_aux), n);
+
+    if (resultado.chaves != chaves)
+    {
+        memcpy(chaves, resultado.chaves, n * sizeof(K));
+        memcpy(cargas, resultado.cargas, n * sizeof(P));
+    }
+
+    delete[] chaves_aux;
+    delete[] cargas_aux;
+}
+
+/*
+    ArgsortMerge: calcula a permutação estável que ordena 'chaves', sem alterá-las.
+
+    Parâmetros:
+        - chaves: vetor das chaves (somente leitura)
+        - n: número de chaves (no máximo UINT32_MAX)
+        - indices: recebe os índices das chaves em ordem crescente de chave; nos empates, em
+          ordem crescente de índice
+
+    Retorno:
+        - false, sem gravar os índices, se houver mais de UINT32_MAX chaves
+
+    Funcionamento:
+        - Copia as chaves e ordena pares (chave, índice) no layout SoA com
+          MergeSortRegistrosSoA: as comparações leem a cópia das chaves em sequência, em vez
+          de chaves[indices[i]], que salta pela memória
+ */
+template <typename K>
+bool ArgsortMerge(const K *chaves, long n, uint32_t *indices)
+{
+    if (n > (long)UINT32_MAX)
+    {
+        fprintf(stderr, "Erro: o argsort aceita no máximo %u chaves\n", UINT32_MAX);
+        return false;
+    }
+
+    K *copia = new K[n > 0 ? n : 1];
+    memcpy(copia, chaves, n * sizeof(K));
+    for (long i = 0; i < n; i++)
+    {
+        indices[i] = (uint32_t)i;
+    }
+
+    MergeSortRegistrosSoA<K, uint32_t>(copia, indices, n);
+
+    delete[] copia;
+    return true;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecMergeSeq: executa o Merge Sort sequencial para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Usa ExecOrdenacaoMapeada: cada arquivo é mapeado em memória, ordenado no próprio
+          lugar com MergeSortSeq e os tempos de ordenação e de E/S são registrados no CSV
+ */
+void ExecMergeSeq(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/merge_seq.csv", "MergeSort - Sequencial", 1,
+                              [](int *vetor, long tamanho, void *) { MergeSortSeq(vetor, tamanho); },
+                              NULL);
+}
+
+/*
+    ExecMergeSeqPingPong: executa o Merge Sort sequencial com buffer ping-pong para múltiplos
+    arquivos binários, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Igual ao ExecMergeSeq, mas ordena os dados com MergeSortSeqPingPong
+ */
+void ExecMergeSeqPingPong(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/merge_seq_pingpong.csv", "MergeSort - Sequencial (ping-pong)", 1,
+                              [](int *vetor, long tamanho, void *) { MergeSortSeqPingPong(vetor, tamanho); },
+                              NULL);
+}
+
+/*
+    ExecMergeRegistros: executa o MergeSortRegistros (AoS) ou o MergeSortRegistrosSoA nos
+    arquivos de registros com carga do tipo P, mede o tempo de ordenação e registra os
+    resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos de registros
+          (GerarArquivosRegistros no mesmo layout)
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+        - layout: LAYOUT_AOS ou LAYOUT_SOA
+
+    Funcionamento:
+        - Usa ExecOrdenacaoMapeada com o arquivo mapeado como um vetor de Registro<int, P>;
+          no SoA o vetor é separado em chaves e cargas (VetoresSoA)
+        - O tipo da carga e o layout aparecem no nome do algoritmo e do CSV individual
+ */
+template <typename P>
+void ExecMergeRegistros(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao,
+                        LayoutRegistros layout)
+{
+    typedef Registro<int, P> R;
+
+    char caminho_csv[256];
+    snprintf(caminho_csv, sizeof(caminho_csv), "results/sequencial/merge_registros_%s_%s.csv",
+             CargaRegistro<P>::Nome(), NomeLayout(layout));
+
+    char nome[64];
+    snprintf(nome, sizeof(nome), "MergeSort - Registros (%s/%s)", CargaRegistro<P>::Nome(), NomeLayout(layout));
+
+    if (layout == LAYOUT_AOS)
+    {
+        ExecOrdenacaoMapeada<R>(entradas, num_entradas, csv_saida, distribuicao, caminho_csv, nome, 1,
+                                [](R *vetor, long tamanho, void *) { MergeSortRegistros(vetor, tamanho); },
+                                NULL);
+    }
+    else
+    {
+        ExecOrdenacaoMapeada<R>(entradas, num_entradas, csv_saida, distribuicao, caminho_csv, nome, 1,
+                                [](R *vetor, long tamanho, void *) {
+                                    int *chaves;
+                                    P *cargas;
+                                    VetoresSoA(vetor, tamanho, &chaves, &cargas);
+                                    MergeSortRegistrosSoA(chaves, cargas, tamanho);
+                                },
+                                NULL);
+    }
+}
+
+/*
+    ExecArgsortMerge: executa o ArgsortMerge nos arquivos de argsort (n chaves int seguidas
+    de espaço para n índices, GerarArquivosArgsort), mede o tempo e registra os resultados
+    em CSV.
+
+    Funcionamento:
+        - O arquivo é mapeado como um vetor de Registro<int, uint32_t> (o mesmo tamanho de
+          uma chave e um índice por elemento) e separado com VetoresSoA; a permutação é
+          gravada no vetor dos índices e as chaves ficam inalteradas
+        - Arquivos com mais de UINT32_MAX chaves são descartados antes da medição
+          (EntradasArgsortValidas), sem linha nos CSVs
+ */
+void ExecArgsortMerge(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    typedef Registro<int, uint32_t> R;
+
+    const char **validas = new const char *[num_entradas > 0 ? num_entradas : 1];
+    int num_validas = EntradasArgsortValidas(entradas, num_entradas, validas);
+
+    ExecOrdenacaoMapeada<R>(validas, num_validas, csv_saida, distribuicao,
+                            "results/sequencial/argsort_merge.csv", "Argsort - MergeSort", 1,
+                            [](R *vetor, long tamanho, void *) {
+                                int *chaves;
+                                uint32_t *indices;
+                                VetoresSoA(vetor, tamanho, &chaves, &indices);
+                                ArgsortMerge(chaves, tamanho, indices);
+                            },
+                            NULL);
+
+    delete[] validas;
+}
@@ -0,0 +1,430 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o Merge Sort Bottom-Up sequencial na CPU com a mesclagem
+    vetorizada (SIMD) por redes bitônicas.
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Ordenar os dados usando Merge Sort (bottom-up) com merge SIMD
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com os dados ordenados
+        5. Registrar tempos em CSV
+
+    No merge escalar (MergeSeq), cada elemento depende de uma comparação cujo resultado
+    é imprevisível em dados aleatórios, e o processador erra muitas previsões de desvio.
+    O merge SIMD carrega 8 (AVX2) ou 16 (AVX-512) inteiros de cada subvetor em registradores
+    e os mescla com uma rede bitônica de instruções min/max, sem desvios por elemento.
+    O único desvio restante é a escolha de qual subvetor fornece o próximo registrador.
+
+    A instrução usada é escolhida em tempo de execução: AVX-512, AVX2 ou, se nenhuma estiver
+    disponível (ou a arquitetura não for x86), o merge escalar MergeSeqPingPong.
+*/
+
+#pragma once
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MERGE_SIMD_X86
+#endif
+
+#include "merge_sort_seq.h"
+
+using namespace std;
+
+// ============================================================
+//           FUNÇÃO DE MESCLAGEM DO FINAL (ESCALAR)
+// ============================================================
+/*
+    MergeTresVias: mescla três sequências ordenadas em 'destino'.
+
+    Parâmetros:
+        - a, na: primeira sequência e seu tamanho
+        - b, nb: segunda sequência e seu tamanho
+        - c, nc: terceira sequência e seu tamanho
+        - destino: vetor que recebe os na + nb + nc elementos mesclados
+
+    Funcionamento:
+        - Usada no final dos merges SIMD, quando um dos subvetores não tem mais elementos
+          suficientes para preencher um registrador: mescla o registrador pendente (a) com
+          o que restou dos dois subvetores (b e c)
+ */
+void MergeTresVias(const int *a, long na, const int *b, long nb, const int *c, long nc, int *destino)
+{
+    long ia = 0, ib = 0, ic = 0;
+    long idx = 0;
+
+    while(ia < na || ib < nb || ic < nc)
+    {
+        // Escolhe a sequência com o menor elemento na frente
+        int origem = -1;
+        int menor = 0;
+        if(ia < na)
+        {
+            origem = 0;
+            menor = a[ia];
+        }
+        if(ib < nb && (origem < 0 || b[ib] < menor))
+        {
+            origem = 1;
+            menor = b[ib];
+        }
+        if(ic < nc && (origem < 0 || c[ic] < menor))
+        {
+            origem = 2;
+            menor = c[ic];
+        }
+
+        destino[idx++] = menor;
+        if(origem == 0) ia++;
+        else if(origem == 1) ib++;
+        else ic++;
+    }
+}
+
+#ifdef MERGE_SIMD_X86
+
+// ============================================================
+//                  MERGE BITÔNICO COM AVX2
+// ============================================================
+/*
+    BitonicoAvx2: ordena uma sequência bitônica de 8 inteiros em um registrador AVX2.
+
+    Funcionamento:
+        - Para as distâncias 4, 2 e 1, compara cada posição i com a posição i ^ distância
+          (permutação), e guarda o mínimo na posição de menor índice do par e o máximo na
+          de maior índice (blend)
+ */
+__attribute__((target("avx2")))
+static inline __m256i BitonicoAvx2(__m256i x)
+{
+    const __m256i dist4 = _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3);
+    const __m256i dist2 = _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5);
+    const __m256i dist1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+
+    __m256i t = _mm256_permutevar8x32_epi32(x, dist4);
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xF0);
+
+    t = _mm256_permutevar8x32_epi32(x, dist2);
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xCC);
+
+    t = _mm256_permutevar8x32_epi32(x, dist1);
+    x = _mm256_blend_epi32(_mm256_min_epi32(x, t), _mm256_max_epi32(x, t), 0xAA);
+
+    return x;
+}
+
+/*
+    MergeRegistradoresAvx2: mescla dois registradores ordenados de 8 inteiros.
+
+    Funcionamento:
+        - Inverte 'b', o que torna a concatenação a || b uma sequência bitônica de 16 elementos
+        - min(a, b) recebe os 8 menores e max(a, b) os 8 maiores, cada um bitônico
+        - Ordena cada metade com BitonicoAvx2
+ */
+__attribute__((target("avx2")))
+static inline void MergeRegistradoresAvx2(__m256i &a, __m256i &b)
+{
+    const __m256i inverte = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+
+    b = _mm256_permutevar8x32_epi32(b, inverte);
+    __m256i menores = _mm256_min_epi32(a, b);
+    __m256i maiores = _mm256_max_epi32(a, b);
+
+    a = BitonicoAvx2(menores);
+    b = BitonicoAvx2(maiores);
+}
+
+/*
+    MergeAvx2: mescla os subvetores ordenados [começo, meio) e [meio, fim) de 'origem'
+    no mesmo intervalo de 'destino', 8 elementos por vez.
+
+    Funcionamento:
+        - Carrega 8 elementos de cada subvetor e os mescla nos registradores
+        - Grava os 8 menores; os 8 maiores ficam pendentes no registrador
+        - Carrega os próximos 8 elementos do subvetor com o menor elemento na frente e repete
+        - Quando um dos subvetores não tem mais 8 elementos, mescla o registrador pendente
+          com o que restou usando MergeTresVias
+ */
+__attribute__((target("avx2")))
+void MergeAvx2(const int *origem, int *destino, long começo, long meio, long fim)
+{
+    const int *esq = origem + começo;
+    const int *dir = origem + meio;
+    long tam_esq = meio - começo;
+    long tam_dir = fim - meio;
+    int *saida = destino + começo;
+
+    if(tam_esq < 8 || tam_dir < 8)
+    {
+        MergeTresVias(NULL, 0, esq, tam_esq, dir, tam_dir, saida);
+        return;
+    }
+
+    __m256i menores = _mm256_loadu_si256((const __m256i *)esq);
+    __m256i maiores = _mm256_loadu_si256((const __m256i *)dir);
+    long idx_esq = 8, idx_dir = 8;
+
+    while(true)
+    {
+        MergeRegistradoresAvx2(menores, maiores);
+        _mm256_storeu_si256((__m256i *)saida, menores);
+        saida += 8;
+
+        bool proximo_esq = idx_esq < tam_esq && (idx_dir >= tam_dir || esq[idx_esq] <= dir[idx_dir]);
+        if(proximo_esq && idx_esq + 8 <= tam_esq)
+        {
+            menores = _mm256_loadu_si256((const __m256i *)(esq + idx_esq));
+            idx_esq += 8;
+        }
+        else if(!proximo_esq && idx_dir + 8 <= tam_dir)
+        {
+            menores = _mm256_loadu_si256((const __m256i *)(dir + idx_dir));
+            idx_dir += 8;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    int pendentes[8];
+    _mm256_storeu_si256((__m256i *)pendentes, maiores);
+    MergeTresVias(pendentes, 8, esq + idx_esq, tam_esq - idx_esq, dir + idx_dir, tam_dir - idx_dir, saida);
+}
+
+// ============================================================
+//                  MERGE BITÔNICO COM AVX-512
+// ============================================================
+/*
+    BitonicoAvx512: ordena uma sequência bitônica de 16 inteiros em um registrador AVX-512.
+
+    Funcionamento:
+        - Igual ao BitonicoAvx2, com as distâncias 8, 4, 2 e 1; as máscaras indicam as
+          posições que recebem o máximo de cada par
+ */
+__attribute__((target("avx512f")))
+static inline __m512i BitonicoAvx512(__m512i x)
+{
+    const __m512i dist8 = _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    const __m512i dist4 = _mm512_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11);
+    const __m512i dist2 = _mm512_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m512i dist1 = _mm512_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+    __m512i t = _mm512_permutexvar_epi32(dist8, x);
+    x = _mm512_mask_blend_epi32(0xFF00, _mm512_min_epi32(x, t), _mm512_max_epi32(x, t));
+
+    t = _mm512_permutexvar_epi32(dist4, x);
+    x = _mm512_mask_blend_epi32(0xF0F0, _mm512_min_epi32(x, t), _mm512_max_epi32(x, t));
+
+    t = _mm512_permutexvar_epi32(dist2, x);
+    x = _mm512_mask_blend_epi32(0xCCCC, _mm512_min_epi32(x, t), _mm512_max_epi32(x, t));
+
+    t = _mm512_permutexvar_epi32(dist1, x);
+    x = _mm512_mask_blend_epi32(0xAAAA, _mm512_min_epi32(x, t), _mm512_max_epi32(x, t));
+
+    return x;
+}
+
+/*
+    MergeRegistradoresAvx512: mescla dois registradores ordenados de 16 inteiros
+    (mesma ideia do MergeRegistradoresAvx2).
+ */
+__attribute__((target("avx512f")))
+static inline void MergeRegistradoresAvx512(__m512i &a, __m512i &b)
+{
+    const __m512i inverte = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    b = _mm512_permutexvar_epi32(inverte, b);
+    __m512i menores = _mm512_min_epi32(a, b);
+    __m512i maiores = _mm512_max_epi32(a, b);
+
+    a = BitonicoAvx512(menores);
+    b = BitonicoAvx512(maiores);
+}
+
+/*
+    MergeAvx512: igual ao MergeAvx2, mas mescla 16 elementos por vez.
+ */
+__attribute__((target("avx512f")))
+void MergeAvx512(const int *origem, int *destino, long começo, long meio, long fim)
+{
+    const int *esq = origem + começo;
+    const int *dir = origem + meio;
+    long tam_esq = meio - começo;
+    long tam_dir = fim - meio;
+    int *saida = destino + começo;
+
+    if(tam_esq < 16 || tam_dir < 16)
+    {
+        MergeTresVias(NULL, 0, esq, tam_esq, dir, tam_dir, saida);
+        return;
+    }
+
+    __m512i menores = _mm512_loadu_si512((const void *)esq);
+    __m512i maiores = _mm512_loadu_si512((const void *)dir);
+    long idx_esq = 16, idx_dir = 16;
+
+    while(true)
+    {
+        MergeRegistradoresAvx512(menores, maiores);
+        _mm512_storeu_si512((void *)saida, menores);
+        saida += 16;
+
+        bool proximo_esq = idx_esq < tam_esq && (idx_dir >= tam_dir || esq[idx_esq] <= dir[idx_dir]);
+        if(proximo_esq && idx_esq + 16 <= tam_esq)
+        {
+            menores = _mm512_loadu_si512((const void *)(esq + idx_esq));
+            idx_esq += 16;
+        }
+        else if(!proximo_esq && idx_dir + 16 <= tam_dir)
+        {
+            menores = _mm512_loadu_si512((const void *)(dir + idx_dir));
+            idx_dir += 16;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    int pendentes[16];
+    _mm512_storeu_si512((void *)pendentes, maiores);
+    MergeTresVias(pendentes, 16, esq + idx_esq, tam_esq - idx_esq, dir + idx_dir, tam_dir - idx_dir, saida);
+}
+
+#endif
+
+// ============================================================
+//              SELEÇÃO DO MERGE EM TEMPO DE EXECUÇÃO
+// ============================================================
+/*
+    FuncaoMerge: assinatura comum dos merges de 'origem' para 'destino'
+    (MergeSeqPingPong, MergeAvx2 e MergeAvx512).
+ */
+typedef void (*FuncaoMerge)(const int *origem, int *destino, long começo, long meio, long fim);
+
+/*
+    SelecionarMergeSimd: escolhe o merge mais largo suportado pelo processador.
+
+    Parâmetros:
+        - nome: se não for NULL, recebe o nome da versão escolhida
+
+    Funcionamento:
+        - Consulta as extensões do processador com __builtin_cpu_supports
+        - Ordem de preferência: AVX-512, AVX2, escalar
+ */
+FuncaoMerge SelecionarMergeSimd(const char **nome)
+{
+#ifdef MERGE_SIMD_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f"))
+    {
+        if(nome) *nome = "AVX-512";
+        return MergeAvx512;
+    }
+    if(__builtin_cpu_supports("avx2"))
+    {
+        if(nome) *nome = "AVX2";
+        return MergeAvx2;
+    }
+#endif
+    if(nome) *nome = "escalar";
+    return MergeSeqPingPong;
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL MERGE SORT SIMD
+// ============================================================
+/*
+    MergeSortSimd: ordena um vetor de inteiros usando Merge Sort bottom-up com merge SIMD.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - n: número de elementos no array
+        - merge: função de merge a ser usada (normalmente a de SelecionarMergeSimd)
+
+    Funcionamento:
+        - Igual ao MergeSortSeqPingPong: ordena blocos de TAMANHO_BLOCO_INICIAL por inserção
+          e faz as passadas alternando entre o vetor e um único buffer auxiliar, mas cada
+          par de subvetores é mesclado com a função 'merge'
+ */
+void MergeSortSimd(int *vetor, long n, FuncaoMerge merge)
+{
+    if(n <= 1)
+    {
+        return;
+    }
+
+    for(long inicio = 0; inicio < n; inicio += TAMANHO_BLOCO_INICIAL)
+    {
+        InsertionSortSeq(vetor, inicio, min(inicio + (long)TAMANHO_BLOCO_INICIAL, n));
+    }
+
+    int *auxiliar = new int[n];
+    int *origem = vetor;
+    int *destino = auxiliar;
+
+    for(long tamanho = TAMANHO_BLOCO_INICIAL; tamanho < n; tamanho *= 2)
+    {
+        for(long começo = 0; começo < n; começo += 2 * tamanho)
+        {
+            long meio = min(começo + tamanho, n);
+            long fim = min(começo + 2 * tamanho, n);
+
+            merge(origem, destino, começo, meio, fim);
+        }
+
+        int *temp = origem;
+        origem = destino;
+        destino = temp;
+    }
+
+    if(origem != vetor)
+    {
+        memcpy(vetor, origem, n * sizeof(int));
+    }
+
+    delete[] auxiliar;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecMergeSimd: executa o Merge Sort com merge SIMD para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Escolhe a versão do merge (AVX-512, AVX2 ou escalar) uma única vez
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com MergeSortSimd
+ */
+void ExecMergeSimd(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    const char *versao;
+    FuncaoMerge merge = SelecionarMergeSimd(&versao);
+    printf("Merge Sort SIMD - usando merge %s\n", versao);
+
+    char nome[64];
+    snprintf(nome, sizeof(nome), "MergeSort - SIMD (%s)", versao);
+
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/merge_simd.csv", nome, 1,
+                              [](int *vetor, long tamanho, void *contexto) {
+                                  MergeSortSimd(vetor, tamanho, *(FuncaoMerge *)contexto);
+                              },
+                              &merge);
+}
@@ -0,0 +1,219 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o Radix Sort MSD no próprio lugar (American flag sort) na CPU.
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Ordenar os dados usando Radix Sort MSD, sem buffer auxiliar
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com os dados ordenados
+        5. Registrar tempos em CSV
+
+    O Radix Sort LSD (RadixSortBase256, RadixSortThread) distribui os elementos a cada passada
+    em um segundo vetor do tamanho da entrada: ordenar o 100m.bin (400 MB) ocupa 800 MB no
+    pico. Aqui os elementos são permutados nos baldes dentro do próprio vetor:
+        - Conta os elementos de cada dígito de RADIX_MSD_BITS bits, do mais significativo
+          para o menos significativo
+        - Permuta por ciclos (cycle leader): o elemento na próxima posição livre de um balde
+          é trocado com o da próxima posição livre do balde a que ele pertence, até que o
+          elemento que chega pertença ao balde atual
+        - Ordena recursivamente cada balde pelo próximo dígito; baldes com até
+          RADIX_MSD_LIMIAR_INSERCAO elementos são ordenados com InsertionSortSeq
+
+    O pico de memória fica no tamanho da entrada mais os histogramas na pilha (um por nível
+    da recursão, no máximo 4). A ordenação não é estável, o que não importa para inteiros.
+    A versão com threads (radix_msd_threads.h) divide os baldes do primeiro nível entre as
+    threads.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "merge_sort_seq.h"
+#include "../../utils/arquivo_mapeado.h"
+
+#define RADIX_MSD_BITS 8
+#define RADIX_MSD_BALDES (1 << RADIX_MSD_BITS)
+#define RADIX_MSD_SINAL 0x80000000u
+#define RADIX_MSD_LIMIAR_INSERCAO 32
+
+/*
+    RADIX_MSD_BITS: bits do dígito processado em cada nível; com 8 bits são no máximo 4 níveis
+        para um int de 32 bits e os histogramas de cada nível (256 contadores) cabem na L1.
+    RADIX_MSD_BALDES: quantidade de valores possíveis de um dígito (2^RADIX_MSD_BITS).
+    RADIX_MSD_SINAL: bit de sinal do int, invertido na extração dos dígitos para que os
+        negativos fiquem antes dos positivos.
+    RADIX_MSD_LIMIAR_INSERCAO: baldes com até esse número de elementos são ordenados por
+        inserção: abaixo dele contar e permutar 256 baldes custa mais que a inserção.
+*/
+
+// ============================================================
+//                  FUNÇÕES AUXILIARES
+// ============================================================
+/*
+    DigitoMSD: dígito de 'valor' no nível com o 'deslocamento' dado (24, 16, 8 ou 0).
+ */
+static inline int DigitoMSD(int valor, int deslocamento)
+{
+    return (int)((((uint32_t)valor ^ RADIX_MSD_SINAL) >> deslocamento) & (RADIX_MSD_BALDES - 1));
+}
+
+/*
+    PermutarBaldesMSD: move cada elemento de vetor[0..tamanho) para o seu balde, no próprio
+    lugar, a partir das contagens de cada dígito.
+
+    Parâmetros:
+        - vetor: elementos a distribuir
+        - count: número de elementos de cada dígito (soma igual a 'tamanho')
+        - deslocamento: deslocamento do dígito usado
+        - inicio: recebe a posição inicial de cada balde (RADIX_MSD_BALDES + 1 posições;
+          inicio[RADIX_MSD_BALDES] é o tamanho)
+
+    Funcionamento:
+        - proximo[d] é a próxima posição ainda não ocupada por um elemento do balde d
+        - Para cada balde d, enquanto houver posição livre: o elemento dessa posição é
+          levado ao balde dele, trazendo de volta o elemento que estava lá, até chegar um
+          elemento do balde d, que ocupa a posição. Cada elemento é escrito uma vez no seu
+          lugar definitivo
+ */
+void PermutarBaldesMSD(int *vetor, const long *count, int deslocamento, long *inicio)
+{
+    long proximo[RADIX_MSD_BALDES];
+
+    long soma = 0;
+    for (int d = 0; d < RADIX_MSD_BALDES; d++)
+    {
+        inicio[d] = soma;
+        proximo[d] = soma;
+        soma += count[d];
+    }
+    inicio[RADIX_MSD_BALDES] = soma;
+
+    for (int d = 0; d < RADIX_MSD_BALDES; d++)
+    {
+        long fim_balde = inicio[d + 1];
+        while (proximo[d] < fim_balde)
+        {
+            int valor = vetor[proximo[d]];
+            int digito = DigitoMSD(valor, deslocamento);
+            while (digito != d)
+            {
+                int temp = vetor[proximo[digito]];
+                vetor[proximo[digito]++] = valor;
+                valor = temp;
+                digito = DigitoMSD(valor, deslocamento);
+            }
+            vetor[proximo[d]++] = valor;
+        }
+    }
+}
+
+// ============================================================
+//            FUNÇÃO PRINCIPAL RADIX SORT MSD (NO LUGAR)
+// ============================================================
+/*
+    RadixSortMSDNivel: ordena vetor[0..tamanho) a partir do dígito com o 'deslocamento' dado,
+    sabendo que os dígitos mais significativos já são iguais em todo o intervalo.
+
+    Funcionamento:
+        - Intervalos pequenos vão direto para InsertionSortSeq
+        - Conta os dígitos; se todos os elementos têm o mesmo dígito, passa para o próximo
+          sem permutar (comum em distribuições com poucos valores ou valores pequenos)
+        - Permuta os elementos nos baldes (PermutarBaldesMSD) e ordena cada balde com mais
+          de um elemento pelo próximo dígito
+ */
+void RadixSortMSDNivel(int *vetor, long tamanho, int deslocamento)
+{
+    long count[RADIX_MSD_BALDES];
+
+    while (true)
+    {
+        if (tamanho <= RADIX_MSD_LIMIAR_INSERCAO)
+        {
+            InsertionSortSeq(vetor, 0, tamanho);
+            return;
+        }
+
+        memset(count, 0, sizeof(count));
+        for (long i = 0; i < tamanho; i++)
+        {
+            count[DigitoMSD(vetor[i], deslocamento)]++;
+        }
+
+        if (count[DigitoMSD(vetor[0], deslocamento)] < tamanho)
+        {
+            break;
+        }
+
+        // Todos têm o mesmo dígito: o intervalo já está separado neste nível
+        if (deslocamento == 0)
+        {
+            return;
+        }
+        deslocamento -= RADIX_MSD_BITS;
+    }
+
+    long inicio[RADIX_MSD_BALDES + 1];
+    PermutarBaldesMSD(vetor, count, deslocamento, inicio);
+
+    if (deslocamento == 0)
+    {
+        return;
+    }
+
+    for (int d = 0; d < RADIX_MSD_BALDES; d++)
+    {
+        if (count[d] > 1)
+        {
+            RadixSortMSDNivel(vetor + inicio[d], count[d], deslocamento - RADIX_MSD_BITS);
+        }
+    }
+}
+
+/*
+    RadixSortMSD: ordena um vetor de inteiros (incluindo negativos) com o Radix Sort MSD no
+    próprio lugar.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho: número de elementos no array
+ */
+void RadixSortMSD(int *vetor, long tamanho)
+{
+    if (tamanho <= 1)
+    {
+        return;
+    }
+
+    RadixSortMSDNivel(vetor, tamanho, 32 - RADIX_MSD_BITS);
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecRadixMSD: executa o Radix Sort MSD no próprio lugar para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com RadixSortMSD; além do
+          mapeamento do arquivo, nenhuma memória proporcional à entrada é alocada
+ */
+void ExecRadixMSD(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/radix_msd.csv", "RadixSort MSD - No lugar", 1,
+                              [](int *vetor, long tamanho, void *) { RadixSortMSD(vetor, tamanho); },
+                              NULL);
+}
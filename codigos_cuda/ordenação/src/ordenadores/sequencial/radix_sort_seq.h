@@ -14,16 +14,42 @@
     processando cada dígito individualmente, da menor para a maior posição (unidades,
     dezenas, centenas, etc). Para cada posição, utiliza o Counting Sort como sub-rotina
     estável para garantir a ordenação correta.
+
+    Também há uma versão em base 256 (RadixSortBase256), que processa a chave em dígitos
+    de RADIX_BITS bits usando deslocamentos e máscaras em vez de divisões e módulos,
+    reaproveita um único buffer auxiliar entre as passadas e pula as passadas em que
+    todos os elementos têm o mesmo dígito. Essa versão aceita a faixa completa de int32_t
+    (negativos inclusive) e, por meio do template RadixSortChaves, chaves uint64_t,
+    int64_t, float e double.
+
+    As variantes chave-valor (RadixSortRegistros, RadixSortRegistrosSoA) usam as mesmas
+    passadas para ordenar registros (registros.h), movendo a carga junto com a chave, e
+    ArgsortRadix devolve a permutação que ordena um vetor de chaves.
 */
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdint.h>
+#include <string.h>
 #include <time.h>
 #include <chrono>
 #include <iostream>
 
+#include "../../utils/arquivo_mapeado.h"
+#include "../../utils/registros.h"
+
 using namespace std;
 
+#define RADIX_BITS 8
+#define RADIX_BALDES (1 << RADIX_BITS)
+
+/*
+    RADIX_BITS: quantidade de bits da chave processados por passada no RadixSortBase256.
+        - Para chaves de 32 bits: 8 bits => 4 passadas de 256 baldes; 11 bits => 3 passadas de 2048 baldes.
+        - Valores maiores reduzem o número de passadas, mas os histogramas deixam de caber na cache L1.
+    RADIX_BALDES: quantidade de valores possíveis de um dígito (2^RADIX_BITS).
+*/
+
 // ============================================================
 //                  FUNÇÃO COUNTING SORT (AUXILIAR)
 // ============================================================
@@ -42,13 +68,13 @@ using namespace std;
         - Reorganiza o vetor de acordo com o dígito atual
         - Copia o resultado ordenado de volta para o vetor original
  */
-void CountingSort(int *vetor, int tamanho, int expoente) 
+void CountingSort(int *vetor, long tamanho, long expoente) 
 {
     int *saida = new int[tamanho]; // vetor auxiliar para saída ordenada
-    int count[10] = {0};           // contadores para cada dígito (0-9)
+    long count[10] = {0};          // contadores para cada dígito (0-9)
 
     // Conta a ocorrência de cada dígito na posição 'expoente'
-    for (int i = 0; i < tamanho; i++)
+    for (long i = 0; i < tamanho; i++)
     {
         count[(vetor[i] / expoente) % 10]++;
     }
@@ -60,14 +86,14 @@ void CountingSort(int *vetor, int tamanho, int expoente)
     }
 
     // Constrói o vetor de saída ordenando pelos dígitos atuais
-    for (int i = tamanho - 1; i >= 0; i--) 
+    for (long i = tamanho - 1; i >= 0; i--) 
     {
         saida[count[(vetor[i] / expoente) % 10] - 1] = vetor[i];
         count[(vetor[i] / expoente) % 10]--;
     }
 
     // Copia o resultado ordenado de volta para o vetor original
-    for (int i = 0; i < tamanho; i++)
+    for (long i = 0; i < tamanho; i++)
     {
         vetor[i] = saida[i];
     }
@@ -91,11 +117,16 @@ void CountingSort(int *vetor, int tamanho, int expoente)
           para ordenar os elementos de acordo com o dígito atual
         - Repete até que todos os dígitos do maior número tenham sido processados
  */
-void RadixSort(int *vetor, int tamanho) 
+void RadixSort(int *vetor, long tamanho) 
 {
+    if (tamanho <= 1)
+    {
+        return;
+    }
+
     int max = vetor[0];
     // Encontra o maior elemento para saber quantos dígitos processar
-    for (int i = 1; i < tamanho; i++)
+    for (long i = 1; i < tamanho; i++)
     {
         if (vetor[i] > max)
         {
@@ -104,95 +135,581 @@ void RadixSort(int *vetor, int tamanho)
     }
 
     // Ordena por cada dígito, da menor para a maior posição decimal
-    for (int expoente = 1; max / expoente > 0; expoente *= 10)
+    for (long expoente = 1; max / expoente > 0; expoente *= 10)
     {
         CountingSort(vetor, tamanho, expoente);
     }
 }
 
 // ============================================================
-//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+//          CODIFICAÇÃO DAS CHAVES PARA O RADIX SORT
 // ============================================================
 /*
-    ExecRadixSeq: executa o Radix Sort sequencial nos arquivos binários
-    mede o tempo de ordenação e registra os resultados em CSV.
- 
+    ChaveRadix<T>: converte uma chave do tipo T em um inteiro sem sinal (SemSinal) cuja
+    ordem, comparando bit a bit, é a mesma ordem dos valores originais.
+
+    Funcionamento:
+        - Inteiros sem sinal: a própria representação já está na ordem correta
+        - Inteiros com sinal (complemento de dois): inverte o bit de sinal, de forma que
+          os negativos passem a vir antes dos positivos
+        - Ponto flutuante (IEEE 754): se o valor é negativo inverte todos os bits (a
+          magnitude cresce no sentido contrário), senão inverte apenas o bit de sinal
+        - Decodificar desfaz a transformação depois da ordenação
+ */
+template <typename T> struct ChaveRadix;
+
+template <> struct ChaveRadix<uint32_t>
+{
+    typedef uint32_t SemSinal;
+    static const char *Nome() { return "uint32_t"; }
+    static SemSinal Codificar(uint32_t v) { return v; }
+    static uint32_t Decodificar(SemSinal c) { return c; }
+};
+
+template <> struct ChaveRadix<int32_t>
+{
+    typedef uint32_t SemSinal;
+    static const char *Nome() { return "int32_t"; }
+    static SemSinal Codificar(int32_t v) { return (uint32_t)v ^ 0x80000000u; }
+    static int32_t Decodificar(SemSinal c) { return (int32_t)(c ^ 0x80000000u); }
+};
+
+template <> struct ChaveRadix<uint64_t>
+{
+    typedef uint64_t SemSinal;
+    static const char *Nome() { return "uint64_t"; }
+    static SemSinal Codificar(uint64_t v) { return v; }
+    static uint64_t Decodificar(SemSinal c) { return c; }
+};
+
+template <> struct ChaveRadix<int64_t>
+{
+    typedef uint64_t SemSinal;
+    static const char *Nome() { return "int64_t"; }
+    static SemSinal Codificar(int64_t v) { return (uint64_t)v ^ 0x8000000000000000ull; }
+    static int64_t Decodificar(SemSinal c) { return (int64_t)(c ^ 0x8000000000000000ull); }
+};
+
+template <> struct ChaveRadix<float>
+{
+    typedef uint32_t SemSinal;
+    static const char *Nome() { return "float"; }
+    static SemSinal Codificar(float v)
+    {
+        uint32_t u;
+        memcpy(&u, &v, sizeof(u));
+        return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+    }
+    static float Decodificar(SemSinal c)
+    {
+        uint32_t u = (c & 0x80000000u) ? (c ^ 0x80000000u) : ~c;
+        float v;
+        memcpy(&v, &u, sizeof(v));
+        return v;
+    }
+};
+
+template <> struct ChaveRadix<double>
+{
+    typedef uint64_t SemSinal;
+    static const char *Nome() { return "double"; }
+    static SemSinal Codificar(double v)
+    {
+        uint64_t u;
+        memcpy(&u, &v, sizeof(u));
+        return (u & 0x8000000000000000ull) ? ~u : (u | 0x8000000000000000ull);
+    }
+    static double Decodificar(SemSinal c)
+    {
+        uint64_t u = (c & 0x8000000000000000ull) ? (c ^ 0x8000000000000000ull) : ~c;
+        double v;
+        memcpy(&v, &u, sizeof(v));
+        return v;
+    }
+};
+
+/*
+    LerCodificada / GravarCodificada: leem e gravam a chave codificada de índice i em um vetor
+    que pode ser o próprio vetor das chaves originais.
+        - As chaves codificadas (SemSinal) reaproveitam o espaço das chaves do tipo T; com T
+          float ou double, acessar esse espaço por um ponteiro para inteiro violaria a regra
+          de aliasing estrito, então o acesso é feito com memcpy, que o compilador reduz a
+          uma única leitura ou escrita
+ */
+template <typename U>
+inline U LerCodificada(const void *base, long i)
+{
+    U chave;
+    memcpy(&chave, (const char *)base + i * sizeof(U), sizeof(U));
+    return chave;
+}
+
+template <typename U>
+inline void GravarCodificada(void *base, long i, U chave)
+{
+    memcpy((char *)base + i * sizeof(U), &chave, sizeof(U));
+}
+
+// ============================================================
+//            FUNÇÃO PRINCIPAL RADIX SORT (BASE 256)
+// ============================================================
+/*
+    PrepararPassadaRadix: transforma o histograma de uma passada nas posições iniciais de cada
+    dígito.
+
+    Retorno:
+        - false se todos os 'tamanho' elementos caem no mesmo balde: a passada não mudaria a
+          ordem e pode ser pulada (o histograma não é alterado)
+ */
+bool PrepararPassadaRadix(long *count, long tamanho)
+{
+    for (int d = 0; d < RADIX_BALDES; d++)
+    {
+        if (count[d] == tamanho)
+        {
+            return false;
+        }
+    }
+
+    long soma = 0;
+    for (int d = 0; d < RADIX_BALDES; d++)
+    {
+        long c = count[d];
+        count[d] = soma;
+        soma += c;
+    }
+    return true;
+}
+
+/*
+    RadixSortChaves: ordena um vetor de chaves do tipo T (int32_t, uint32_t, int64_t,
+    uint64_t, float ou double) usando Radix Sort LSD com dígitos de RADIX_BITS bits.
+
     Parâmetros:
-        - entradas: array de caminhos (const char*) para arquivos binários
-        - num_entradas: número de entradas no array
-        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - vetor: ponteiro para o array de chaves a ser ordenado
+        - tamanho: número de elementos no array
 
     Funcionamento:
-        - Para cada arquivo:
-        - Abre o arquivo e determina o número de inteiros
-        - Lê os dados para um vetor alocado dinamicamente
-        - Mede o tempo de ordenação usando chrono
-        - Ordena os dados com RadixSort
-        - Registra o tempo no arquivo CSV
-        - Regrava o arquivo com os dados ordenados
-        - Libera memória utilizada
+        - Em uma única leitura do vetor, codifica cada chave no próprio lugar (ChaveRadix,
+          gravada com GravarCodificada) e monta os histogramas de todas as passadas
+        - Aloca uma única vez o buffer auxiliar, alternado com o vetor a cada passada (ping-pong)
+        - Para cada passada, PrepararPassadaRadix pula a passada se um único dígito contém
+          todos os elementos, pois ela não alteraria a ordem; caso contrário calcula a soma de
+          prefixos e a passada distribui os elementos, de forma estável, no vetor de destino
+        - Decodifica as chaves de volta para o vetor original, trazendo o resultado do
+          buffer auxiliar quando o número de passadas executadas foi ímpar
  */
-void ExecRadixSeq(const char **entradas, int num_entradas, const char *csv_saida)
+template <typename T>
+void RadixSortChaves(T *vetor, long tamanho)
 {
-    FILE *csv = fopen(csv_saida, "a");
-    FILE *seq_radix_csv = fopen("results/sequencial/radix_seq.csv", "a");
-    if (!csv || !seq_radix_csv)
+    typedef typename ChaveRadix<T>::SemSinal U;
+    const int passadas = (int)((sizeof(U) * 8 + RADIX_BITS - 1) / RADIX_BITS);
+
+    if (tamanho <= 1)
     {
-        perror("Erro ao abrir arquivo CSV");
         return;
     }
 
-    fprintf(seq_radix_csv, "Tamanho,Tempo\n");
+    static_assert(sizeof(U) == sizeof(T), "as chaves codificadas ocupam o espaço do vetor");
+    U *auxiliar = new U[tamanho];
+    long histogramas[passadas][RADIX_BALDES];
+    memset(histogramas, 0, sizeof(histogramas));
+
+    // Codifica as chaves no próprio vetor e conta os dígitos de todas as passadas em uma única leitura
+    for (long i = 0; i < tamanho; i++)
+    {
+        U chave = ChaveRadix<T>::Codificar(vetor[i]);
+        GravarCodificada<U>(vetor, i, chave);
+        for (int p = 0; p < passadas; p++)
+        {
+            histogramas[p][(chave >> (p * RADIX_BITS)) & (RADIX_BALDES - 1)]++;
+        }
+    }
+
+    void *origem = vetor;
+    void *destino = auxiliar;
 
-    for(int i = 0; i < num_entradas; i++)
+    for (int p = 0; p < passadas; p++)
     {
-        FILE *file = fopen(entradas[i], "rb+");
-        if(!file)
+        long *count = histogramas[p];
+        int deslocamento = p * RADIX_BITS;
+        if (!PrepararPassadaRadix(count, tamanho))
         {
-            perror(entradas[i]);
             continue;
         }
 
-        // Determina o número de inteiros no arquivo
-        fseek(file, 0, SEEK_END);
-        long tamanho = ftell(file) / sizeof(int);
-        fseek(file, 0, SEEK_SET);
+        // Distribui os elementos no vetor de destino mantendo a estabilidade
+        for (long i = 0; i < tamanho; i++)
+        {
+            U chave = LerCodificada<U>(origem, i);
+            GravarCodificada<U>(destino, count[(chave >> deslocamento) & (RADIX_BALDES - 1)]++, chave);
+        }
+
+        void *temp = origem;
+        origem = destino;
+        destino = temp;
+    }
+
+    // Decodifica as chaves; se o número de passadas executadas foi ímpar, origem é o buffer auxiliar
+    for (long i = 0; i < tamanho; i++)
+    {
+        vetor[i] = ChaveRadix<T>::Decodificar(LerCodificada<U>(origem, i));
+    }
+
+    delete[] auxiliar;
+}
+
+/*
+    RadixSortBase256: ordena um vetor de inteiros (incluindo negativos) com RadixSortChaves.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho: número de elementos no array
+ */
+void RadixSortBase256(int *vetor, long tamanho)
+{
+    RadixSortChaves<int32_t>(vetor, tamanho);
+}
+
+// ============================================================
+//          RADIX SORT DE REGISTROS (CHAVE-VALOR)
+// ============================================================
+/*
+    RadixSortRegistros: ordena um vetor de registros (layout AoS) pela chave, com o Radix Sort
+    LSD em base 256 do RadixSortChaves.
+
+    Parâmetros:
+        - vetor: registros a serem ordenados; a chave pode ser de qualquer tipo de ChaveRadix
+        - tamanho: número de registros
+
+    Funcionamento:
+        - Monta os histogramas de todas as passadas em uma única leitura
+        - Cada passada não trivial distribui os registros inteiros no buffer auxiliar
+          (ping-pong); a chave é codificada (ChaveRadix) a cada leitura, sem alterar o registro
+        - Estável, como toda passada do LSD
+ */
+template <typename K, typename P>
+void RadixSortRegistros(Registro<K, P> *vetor, long tamanho)
+{
+    typedef Registro<K, P> R;
+    typedef typename ChaveRadix<K>::SemSinal U;
+    const int passadas = (int)((sizeof(U) * 8 + RADIX_BITS - 1) / RADIX_BITS);
+
+    if (tamanho <= 1)
+    {
+        return;
+    }
+
+    long histogramas[passadas][RADIX_BALDES];
+    memset(histogramas, 0, sizeof(histogramas));
+    for (long i = 0; i < tamanho; i++)
+    {
+        U chave = ChaveRadix<K>::Codificar(vetor[i].chave);
+        for (int p = 0; p < passadas; p++)
+        {
+            histogramas[p][(chave >> (p * RADIX_BITS)) & (RADIX_BALDES - 1)]++;
+        }
+    }
+
+    R *auxiliar = new R[tamanho];
+    R *origem = vetor;
+    R *destino = auxiliar;
 
-        int *v = new int[tamanho];
-        if(fread(v, sizeof(int), tamanho, file) != (size_t)tamanho)
+    for (int p = 0; p < passadas; p++)
+    {
+        long *count = histogramas[p];
+        int deslocamento = p * RADIX_BITS;
+        if (!PrepararPassadaRadix(count, tamanho))
         {
-            perror("Erro ao ler o arquivo");
-            fclose(file);
-            delete[] v;
             continue;
         }
 
-        // Mede o tempo de ordenação usando chrono
-        auto start = chrono::high_resolution_clock::now();
-        RadixSort(v, tamanho);
-        auto end = chrono::high_resolution_clock::now();
-        chrono::duration<double> elapsed = end - start;
-        double tempo = elapsed.count();
+        for (long i = 0; i < tamanho; i++)
+        {
+            U chave = ChaveRadix<K>::Codificar(origem[i].chave);
+            destino[count[(chave >> deslocamento) & (RADIX_BALDES - 1)]++] = origem[i];
+        }
 
-        printf("Radix Sort Sequencial - Tempo para ordenar %s: %f segundos\n", entradas[i], tempo);
+        R *temp = origem;
+        origem = destino;
+        destino = temp;
+    }
 
-        fprintf(csv, "RadixSort Sequencial,%ld,%f\n", tamanho, tempo);
-        fprintf(seq_radix_csv, "%ld,%f\n", tamanho, tempo);
+    if (origem != vetor)
+    {
+        memcpy(vetor, origem, tamanho * sizeof(R));
+    }
 
-        // Regrava o arquivo com os dados ordenados
-        fseek(file, 0, SEEK_SET);
-        if(fwrite(v, sizeof(int), tamanho, file) != tamanho)
+    delete[] auxiliar;
+}
+
+/*
+    RadixSortRegistrosSoA: ordena registros no layout SoA (vetor de chaves e vetor de cargas)
+    pela chave, com o Radix Sort LSD em base 256.
+
+    Parâmetros:
+        - chaves: vetor das chaves
+        - cargas: vetor das cargas; cargas[i] é a carga de chaves[i]
+        - tamanho: número de registros
+
+    Funcionamento:
+        - Como o RadixSortChaves, codifica as chaves no próprio lugar (GravarCodificada) e
+          monta os histogramas na mesma leitura, e as decodifica no final
+        - Cada passada não trivial lê as chaves em sequência e move chave e carga para os
+          buffers auxiliares de cada vetor
+ */
+template <typename K, typename P>
+void RadixSortRegistrosSoA(K *chaves, P *cargas, long tamanho)
+{
+    typedef typename ChaveRadix<K>::SemSinal U;
+    const int passadas = (int)((sizeof(U) * 8 + RADIX_BITS - 1) / RADIX_BITS);
+
+    if (tamanho <= 1)
+    {
+        return;
+    }
+
+    static_assert(sizeof(U) == sizeof(K), "as chaves codificadas ocupam o espaço das chaves");
+    long histogramas[passadas][RADIX_BALDES];
+    memset(histogramas, 0, sizeof(histogramas));
+    for (long i = 0; i < tamanho; i++)
+    {
+        U chave = ChaveRadix<K>::Codificar(chaves[i]);
+        GravarCodificada<U>(chaves, i, chave);
+        for (int p = 0; p < passadas; p++)
+        {
+            histogramas[p][(chave >> (p * RADIX_BITS)) & (RADIX_BALDES - 1)]++;
+        }
+    }
+
+    U *chaves_aux = new U[tamanho];
+    P *cargas_aux = new P[tamanho];
+    void *origem_chaves = chaves, *destino_chaves = chaves_aux;
+    P *origem_cargas = cargas, *destino_cargas = cargas_aux;
+
+    for (int p = 0; p < passadas; p++)
+    {
+        long *count = histogramas[p];
+        int deslocamento = p * RADIX_BITS;
+        if (!PrepararPassadaRadix(count, tamanho))
         {
-            perror("Erro ao escrever no arquivo");
-            fclose(file);
-            delete[] v;
             continue;
         }
 
-        fclose(file);
-        delete[] v;
+        for (long i = 0; i < tamanho; i++)
+        {
+            U chave = LerCodificada<U>(origem_chaves, i);
+            long posicao = count[(chave >> deslocamento) & (RADIX_BALDES - 1)]++;
+            GravarCodificada<U>(destino_chaves, posicao, chave);
+            destino_cargas[posicao] = origem_cargas[i];
+        }
+
+        void *temp_chaves = origem_chaves;
+        origem_chaves = destino_chaves;
+        destino_chaves = temp_chaves;
+        P *temp_cargas = origem_cargas;
+        origem_cargas = destino_cargas;
+        destino_cargas = temp_cargas;
+    }
+
+    for (long i = 0; i < tamanho; i++)
+    {
+        chaves[i] = ChaveRadix<K>::Decodificar(LerCodificada<U>(origem_chaves, i));
+    }
+    if (origem_cargas != cargas)
+    {
+        memcpy(cargas, origem_cargas, tamanho * sizeof(P));
+    }
+
+    delete[] chaves_aux;
+    delete[] cargas_aux;
+}
+
+/*
+    ArgsortRadix: calcula a permutação estável que ordena 'chaves', sem alterá-las.
+
+    Parâmetros:
+        - chaves: vetor das chaves (somente leitura)
+        - tamanho: número de chaves (no máximo UINT32_MAX)
+        - indices: recebe os índices das chaves em ordem crescente de chave; nos empates, em
+          ordem crescente de índice
+
+    Retorno:
+        - false, sem gravar os índices, se houver mais de UINT32_MAX chaves
+
+    Funcionamento:
+        - Copia as chaves e ordena pares (chave, índice) no layout SoA com RadixSortRegistrosSoA
+ */
+template <typename K>
+bool ArgsortRadix(const K *chaves, long tamanho, uint32_t *indices)
+{
+    if (tamanho > (long)UINT32_MAX)
+    {
+        fprintf(stderr, "Erro: o argsort aceita no máximo %u chaves\n", UINT32_MAX);
+        return false;
     }
 
-    fclose(csv);
-    fclose(seq_radix_csv);
-}
\ No newline at end of file
+    K *copia = new K[tamanho > 0 ? tamanho : 1];
+    memcpy(copia, chaves, tamanho * sizeof(K));
+    for (long i = 0; i < tamanho; i++)
+    {
+        indices[i] = (uint32_t)i;
+    }
+
+    RadixSortRegistrosSoA<K, uint32_t>(copia, indices, tamanho);
+
+    delete[] copia;
+    return true;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecRadixSeq: executa o Radix Sort sequencial nos arquivos binários
+    mede o tempo de ordenação e registra os resultados em CSV.
+ 
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Usa ExecOrdenacaoMapeada: cada arquivo é mapeado em memória, ordenado no próprio
+          lugar com RadixSort e os tempos de ordenação e de E/S são registrados no CSV
+ */
+void ExecRadixSeq(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/radix_seq.csv", "RadixSort Sequencial", 1,
+                              [](int *vetor, long tamanho, void *) { RadixSort(vetor, tamanho); },
+                              NULL);
+}
+
+/*
+    ExecRadixSeqBase256: executa o Radix Sort sequencial em base 256 nos arquivos binários,
+    mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Igual ao ExecRadixSeq, mas ordena os dados com RadixSortBase256
+ */
+void ExecRadixSeqBase256(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/radix_seq_base256.csv", "RadixSort Sequencial (base 256)", 1,
+                              [](int *vetor, long tamanho, void *) { RadixSortBase256(vetor, tamanho); },
+                              NULL);
+}
+
+/*
+    ExecRadixSeqChaves: executa o RadixSortChaves<T> nos arquivos binários com chaves do tipo T
+    (int32_t, uint32_t, int64_t, uint64_t, float ou double), mede o tempo de ordenação e registra
+    os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Igual ao ExecRadixSeq, mas o arquivo é mapeado como um vetor de T e o tipo
+          da chave aparece no nome do algoritmo e do CSV individual
+ */
+template <typename T>
+void ExecRadixSeqChaves(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    const char *nome_tipo = ChaveRadix<T>::Nome();
+
+    char caminho_csv[256];
+    snprintf(caminho_csv, sizeof(caminho_csv), "results/sequencial/radix_seq_%s.csv", nome_tipo);
+
+    char nome[64];
+    snprintf(nome, sizeof(nome), "RadixSort Sequencial (%s)", nome_tipo);
+
+    ExecOrdenacaoMapeada<T>(entradas, num_entradas, csv_saida, distribuicao, caminho_csv, nome, 1,
+                            [](T *vetor, long tamanho, void *) { RadixSortChaves<T>(vetor, tamanho); },
+                            NULL);
+}
+
+/*
+    ExecRadixRegistros: executa o RadixSortRegistros (AoS) ou o RadixSortRegistrosSoA nos
+    arquivos de registros com carga do tipo P, mede o tempo de ordenação e registra os
+    resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos de registros
+          (GerarArquivosRegistros no mesmo layout)
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+        - layout: LAYOUT_AOS ou LAYOUT_SOA
+
+    Funcionamento:
+        - Igual ao ExecMergeRegistros, ordenando com o Radix Sort
+ */
+template <typename P>
+void ExecRadixRegistros(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao,
+                        LayoutRegistros layout)
+{
+    typedef Registro<int, P> R;
+
+    char caminho_csv[256];
+    snprintf(caminho_csv, sizeof(caminho_csv), "results/sequencial/radix_registros_%s_%s.csv",
+             CargaRegistro<P>::Nome(), NomeLayout(layout));
+
+    char nome[64];
+    snprintf(nome, sizeof(nome), "RadixSort - Registros (%s/%s)", CargaRegistro<P>::Nome(), NomeLayout(layout));
+
+    if (layout == LAYOUT_AOS)
+    {
+        ExecOrdenacaoMapeada<R>(entradas, num_entradas, csv_saida, distribuicao, caminho_csv, nome, 1,
+                                [](R *vetor, long tamanho, void *) { RadixSortRegistros(vetor, tamanho); },
+                                NULL);
+    }
+    else
+    {
+        ExecOrdenacaoMapeada<R>(entradas, num_entradas, csv_saida, distribuicao, caminho_csv, nome, 1,
+                                [](R *vetor, long tamanho, void *) {
+                                    int *chaves;
+                                    P *cargas;
+                                    VetoresSoA(vetor, tamanho, &chaves, &cargas);
+                                    RadixSortRegistrosSoA(chaves, cargas, tamanho);
+                                },
+                                NULL);
+    }
+}
+
+/*
+    ExecArgsortRadix: executa o ArgsortRadix nos arquivos de argsort (GerarArquivosArgsort),
+    mede o tempo e registra os resultados em CSV.
+
+    Funcionamento:
+        - Igual ao ExecArgsortMerge, calculando a permutação com o Radix Sort
+ */
+void ExecArgsortRadix(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    typedef Registro<int, uint32_t> R;
+
+    const char **validas = new const char *[num_entradas > 0 ? num_entradas : 1];
+    int num_validas = EntradasArgsortValidas(entradas, num_entradas, validas);
+
+    ExecOrdenacaoMapeada<R>(validas, num_validas, csv_saida, distribuicao,
+                            "results/sequencial/argsort_radix.csv", "Argsort - RadixSort", 1,
+                            [](R *vetor, long tamanho, void *) {
+                                int *chaves;
+                                uint32_t *indices;
+                                VetoresSoA(vetor, tamanho, &chaves, &indices);
+                                ArgsortRadix(chaves, tamanho, indices);
+                            },
+                            NULL);
+
+    delete[] validas;
+}
@@ -0,0 +1,343 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa os modos de seleção sequenciais na CPU: em vez de ordenar o
+    vetor inteiro, cada um garante apenas o que uma consulta de percentil ou de top-k precisa
+    (ModoSelecao, em selecao.h).
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Selecionar os k = ElementosSelecionados(n) menores elementos
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com o resultado
+        5. Registrar tempos em CSV
+
+    Os seletores são:
+        - QuickselectSeq (nth_element): particiona em três partes (menores, iguais e maiores
+          que o pivô) e continua apenas na parte que contém a posição procurada: O(n) em média
+        - RadixSelectSeq (nth_element): como o Radix Sort MSD, separa os elementos pelo dígito
+          mais significativo, mas continua apenas no balde que contém a posição; cada nível
+          reduz o intervalo em cerca de 256 vezes, sem comparações com pivôs
+        - TopKHeap (top-k): max-heap dos k menores elementos no início do vetor, atualizado a
+          cada elemento menor que o topo; O(n log k), bom para k pequeno
+        - OrdenacaoParcial: QuickselectSeq seguido da ordenação dos k - 1 primeiros com o
+          RadixSortMSD; O(n + k log k)
+
+    Todos trabalham no próprio vetor, apenas trocando elementos de posição.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "merge_sort_seq.h"
+#include "radix_sort_msd.h"
+#include "../../utils/arquivo_mapeado.h"
+#include "../../utils/gerador.h"
+#include "../../utils/selecao.h"
+
+#define SELECAO_LIMIAR_INSERCAO 16
+
+/*
+    SELECAO_LIMIAR_INSERCAO: intervalos com até esse número de elementos são resolvidos por
+        inserção no quickselect e no radix select.
+*/
+
+// ============================================================
+//                  QUICKSELECT (NTH_ELEMENT)
+// ============================================================
+/*
+    TrocarElementos: troca vetor[i] e vetor[j].
+ */
+static inline void TrocarElementos(int *vetor, long i, long j)
+{
+    int temp = vetor[i];
+    vetor[i] = vetor[j];
+    vetor[j] = temp;
+}
+
+/*
+    QuickselectSeq: coloca em vetor[posicao] o elemento que estaria nessa posição no vetor
+    ordenado, com os menores ou iguais antes e os maiores ou iguais depois.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros
+        - tamanho: número de elementos no array
+        - posicao: posição procurada (0 a tamanho - 1)
+
+    Funcionamento:
+        - O pivô é a mediana de três elementos em posições pseudoaleatórias do intervalo
+          (MisturarSplitMix64 de um contador), o que evita o caso quadrático nas entradas
+          ordenadas, invertidas ou em serra
+        - Partição de Dijkstra em três partes: [esq, menores) < pivô, [menores, maiores) ==
+          pivô e [maiores, dir) > pivô. Com muitos valores repetidos a parte dos iguais
+          termina a seleção de uma vez
+        - Continua na parte que contém 'posicao'; intervalos pequenos são ordenados por inserção
+ */
+void QuickselectSeq(int *vetor, long tamanho, long posicao)
+{
+    long esq = 0, dir = tamanho;
+    uint64_t contador = (uint64_t)tamanho;
+
+    while (dir - esq > SELECAO_LIMIAR_INSERCAO)
+    {
+        long n = dir - esq;
+        int a = vetor[esq + (long)(MisturarSplitMix64(++contador) % n)];
+        int b = vetor[esq + (long)(MisturarSplitMix64(++contador) % n)];
+        int c = vetor[esq + (long)(MisturarSplitMix64(++contador) % n)];
+        int pivo = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+
+        long menores = esq, i = esq, maiores = dir;
+        while (i < maiores)
+        {
+            int valor = vetor[i];
+            if (valor < pivo)
+            {
+                TrocarElementos(vetor, i++, menores++);
+            }
+            else if (valor > pivo)
+            {
+                TrocarElementos(vetor, i, --maiores);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        if (posicao < menores)
+        {
+            dir = menores;
+        }
+        else if (posicao >= maiores)
+        {
+            esq = maiores;
+        }
+        else
+        {
+            return; // a posição está entre os iguais ao pivô
+        }
+    }
+
+    InsertionSortSeq(vetor, esq, dir);
+}
+
+// ============================================================
+//                  RADIX SELECT (NTH_ELEMENT)
+// ============================================================
+/*
+    RadixSelectSeq: mesmo resultado do QuickselectSeq, separando os elementos pelos dígitos de
+    RADIX_MSD_BITS bits, do mais significativo para o menos significativo.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros (incluindo negativos)
+        - tamanho: número de elementos no array
+        - posicao: posição procurada (0 a tamanho - 1)
+
+    Funcionamento:
+        * Para cada dígito, no intervalo [esq, dir) que contém a posição:
+        - Conta os elementos de cada dígito e encontra o dígito 'alvo' do balde que contém a
+          posição
+        - Particiona o intervalo em três partes pelo dígito: menor que o alvo, igual e maior
+          (partição de Dijkstra, como no QuickselectSeq); se todos têm o dígito alvo, não há
+          o que mover
+        - Continua apenas na parte do dígito alvo
+        - Após o último dígito, o intervalo só tem elementos iguais; intervalos pequenos são
+          ordenados por inserção
+ */
+void RadixSelectSeq(int *vetor, long tamanho, long posicao)
+{
+    long esq = 0, dir = tamanho;
+    long count[RADIX_MSD_BALDES];
+
+    for (int deslocamento = 32 - RADIX_MSD_BITS; deslocamento >= 0; deslocamento -= RADIX_MSD_BITS)
+    {
+        if (dir - esq <= SELECAO_LIMIAR_INSERCAO)
+        {
+            InsertionSortSeq(vetor, esq, dir);
+            return;
+        }
+
+        memset(count, 0, sizeof(count));
+        for (long i = esq; i < dir; i++)
+        {
+            count[DigitoMSD(vetor[i], deslocamento)]++;
+        }
+
+        // Dígito do balde que contém a posição
+        int alvo = 0;
+        long inicio_alvo = esq;
+        while (inicio_alvo + count[alvo] <= posicao)
+        {
+            inicio_alvo += count[alvo];
+            alvo++;
+        }
+
+        if (count[alvo] == dir - esq)
+        {
+            continue;
+        }
+
+        long menores = esq, i = esq, maiores = dir;
+        while (i < maiores)
+        {
+            int digito = DigitoMSD(vetor[i], deslocamento);
+            if (digito < alvo)
+            {
+                TrocarElementos(vetor, i++, menores++);
+            }
+            else if (digito > alvo)
+            {
+                TrocarElementos(vetor, i, --maiores);
+            }
+            else
+            {
+                i++;
+            }
+        }
+
+        esq = menores;
+        dir = maiores;
+    }
+}
+
+// ============================================================
+//                  TOP-K COM HEAP
+// ============================================================
+/*
+    DescerHeap: restaura a propriedade de max-heap de heap[0..tamanho) a partir da posição i.
+ */
+static inline void DescerHeap(int *heap, long tamanho, long i)
+{
+    int valor = heap[i];
+    while (true)
+    {
+        long filho = 2 * i + 1;
+        if (filho >= tamanho)
+            break;
+        if (filho + 1 < tamanho && heap[filho + 1] > heap[filho])
+            filho++;
+        if (heap[filho] <= valor)
+            break;
+
+        heap[i] = heap[filho];
+        i = filho;
+    }
+    heap[i] = valor;
+}
+
+/*
+    TopKHeap: coloca os k menores elementos, em ordem crescente, em vetor[0..k).
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros
+        - tamanho: número de elementos no array
+        - k: número de elementos selecionados (1 a tamanho)
+
+    Funcionamento:
+        - Monta um max-heap com os k primeiros elementos, no próprio vetor
+        - Para cada elemento seguinte menor que o topo (o maior dos k menores até agora),
+          troca os dois e desce o novo topo: o heap continua com os k menores vistos
+        - Ordena o heap no próprio lugar (heapsort), retirando o maior para o final
+        - Em dados aleatórios poucos elementos entram no heap (cerca de k ln(n / k)), e o
+          custo fica próximo de uma leitura do vetor
+ */
+void TopKHeap(int *vetor, long tamanho, long k)
+{
+    for (long i = k / 2 - 1; i >= 0; i--)
+    {
+        DescerHeap(vetor, k, i);
+    }
+
+    for (long i = k; i < tamanho; i++)
+    {
+        if (vetor[i] < vetor[0])
+        {
+            TrocarElementos(vetor, i, 0);
+            DescerHeap(vetor, k, 0);
+        }
+    }
+
+    for (long fim = k - 1; fim > 0; fim--)
+    {
+        TrocarElementos(vetor, 0, fim);
+        DescerHeap(vetor, fim, 0);
+    }
+}
+
+// ============================================================
+//                  ORDENAÇÃO PARCIAL
+// ============================================================
+/*
+    OrdenacaoParcial: mesmo resultado do TopKHeap, com seleção seguida de ordenação.
+
+    Funcionamento:
+        - QuickselectSeq coloca o k-ésimo menor em vetor[k - 1], com os menores antes dele
+        - RadixSortMSD ordena vetor[0..k - 1) no próprio lugar
+ */
+void OrdenacaoParcial(int *vetor, long tamanho, long k)
+{
+    QuickselectSeq(vetor, tamanho, k - 1);
+    RadixSortMSD(vetor, k - 1);
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecQuickselect / ExecRadixSelect / ExecTopKHeap / ExecOrdenacaoParcial: executam o seletor
+    correspondente para múltiplos arquivos binários contendo inteiros, medem o tempo e
+    registram os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Usam ExecOrdenacaoMapeada com k = ElementosSelecionados(n), como as ordenações,
+          para que os tempos sejam comparáveis com os da ordenação completa
+ */
+void ExecQuickselect(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/nth_quickselect.csv", "Seleção - Quickselect (nth_element)", 1,
+                              [](int *vetor, long tamanho, void *) {
+                                  QuickselectSeq(vetor, tamanho, ElementosSelecionados(tamanho) - 1);
+                              },
+                              NULL);
+}
+
+void ExecRadixSelect(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/nth_radix.csv", "Seleção - Radix Select (nth_element)", 1,
+                              [](int *vetor, long tamanho, void *) {
+                                  RadixSelectSeq(vetor, tamanho, ElementosSelecionados(tamanho) - 1);
+                              },
+                              NULL);
+}
+
+void ExecTopKHeap(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/topk_heap.csv", "Seleção - Top-k com heap", 1,
+                              [](int *vetor, long tamanho, void *) {
+                                  TopKHeap(vetor, tamanho, ElementosSelecionados(tamanho));
+                              },
+                              NULL);
+}
+
+void ExecOrdenacaoParcial(const char **entradas, int num_entradas, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/sequencial/parcial_quickselect.csv", "Seleção - Ordenação parcial (quickselect + radix)", 1,
+                              [](int *vetor, long tamanho, void *) {
+                                  OrdenacaoParcial(vetor, tamanho, ElementosSelecionados(tamanho));
+                              },
+                              NULL);
+}
@@ -0,0 +1,444 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o Merge Sort top-down recursivo de forma paralela na CPU, com
+    tarefas (fork-join) distribuídas por um escalonador com roubo de trabalho (work stealing).
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Ordenar os dados usando Merge Sort recursivo com tarefas
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com os dados ordenados
+        5. Registrar tempos em CSV
+
+    Diferente do MergeSortThread (merge_sort_threads.h), que sincroniza todas as threads
+    com uma barreira a cada passada, aqui cada chamada recursiva cria uma tarefa para uma
+    das metades e executa a outra. Cada thread guarda as tarefas que criou em uma fila
+    própria (deque): consome as mais recentes pelo final e, quando fica sem trabalho,
+    rouba as mais antigas (e maiores) do início da fila de outra thread. Ao esperar as
+    tarefas filhas, a thread executa outras tarefas em vez de ficar parada.
+
+    Abaixo de CORTE_SEQUENCIAL_TAREFAS elementos a ordenação e o merge são sequenciais.
+    Os merges grandes também são divididos em tarefas com CoRank (merge path).
+*/
+
+#pragma once
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <atomic>
+#include <deque>
+#include <pthread.h>
+#include <sched.h>
+
+#include "pool_threads.h"
+#include "merge_sort_threads.h"
+#include "../sequencial/merge_sort_seq.h"
+
+#include "../../utils/arquivo_mapeado.h"
+
+using namespace std;
+
+#define CORTE_SEQUENCIAL_TAREFAS 8192
+
+/*
+    CORTE_SEQUENCIAL_TAREFAS: tamanho abaixo do qual ordenações e merges não criam mais tarefas.
+        - Valores pequenos geram muitas tarefas e mais custo de escalonamento.
+        - Valores grandes reduzem o paralelismo disponível para o roubo de trabalho.
+*/
+
+// ============================================================
+//             ESCALONADOR COM ROUBO DE TRABALHO
+// ============================================================
+/*
+    Estrutura Tarefa: uma unidade de trabalho criada por CriarTarefa.
+
+    Campos:
+        - funcao: função a ser executada, recebendo o argumento e o id da thread que a executa
+        - arg: argumento da função (liberado pela própria função)
+        - pendentes: contador do grupo de tarefas, decrementado quando a tarefa termina
+ */
+struct Tarefa {
+    void (*funcao)(void *arg, int id);
+    void *arg;
+    atomic<long> *pendentes;
+};
+
+/*
+    Estrutura Escalonador: filas de tarefas de cada thread.
+
+    Campos:
+        - num_threads: número de threads
+        - filas: uma fila (deque) de tarefas por thread
+        - travas: um mutex por fila
+        - terminado: sinaliza às threads que a tarefa raiz terminou
+ */
+struct Escalonador {
+    int num_threads;
+    deque<Tarefa> *filas;
+    pthread_mutex_t *travas;
+    atomic<bool> terminado;
+};
+
+/*
+    CriarTarefa: cria uma tarefa na fila da thread 'id' (fork).
+
+    Parâmetros:
+        - esc: escalonador
+        - id: thread que cria a tarefa
+        - funcao, arg: trabalho a ser executado
+        - pendentes: contador do grupo, aguardado depois com AguardarTarefas
+ */
+void CriarTarefa(Escalonador *esc, int id, void (*funcao)(void *, int), void *arg, atomic<long> *pendentes)
+{
+    pendentes->fetch_add(1);
+
+    Tarefa tarefa;
+    tarefa.funcao = funcao;
+    tarefa.arg = arg;
+    tarefa.pendentes = pendentes;
+
+    pthread_mutex_lock(&esc->travas[id]);
+    esc->filas[id].push_back(tarefa);
+    pthread_mutex_unlock(&esc->travas[id]);
+}
+
+/*
+    ExecutarUmaTarefa: executa uma tarefa disponível, se houver.
+
+    Retorno:
+        - true se alguma tarefa foi executada
+
+    Funcionamento:
+        - Tenta primeiro a tarefa mais recente da própria fila (final do deque)
+        - Senão, percorre as outras threads e rouba a tarefa mais antiga (início do deque)
+ */
+bool ExecutarUmaTarefa(Escalonador *esc, int id)
+{
+    Tarefa tarefa;
+    bool encontrou = false;
+
+    pthread_mutex_lock(&esc->travas[id]);
+    if(!esc->filas[id].empty())
+    {
+        tarefa = esc->filas[id].back();
+        esc->filas[id].pop_back();
+        encontrou = true;
+    }
+    pthread_mutex_unlock(&esc->travas[id]);
+
+    for(int k = 1; !encontrou && k < esc->num_threads; k++)
+    {
+        int vitima = (id + k) % esc->num_threads;
+
+        pthread_mutex_lock(&esc->travas[vitima]);
+        if(!esc->filas[vitima].empty())
+        {
+            tarefa = esc->filas[vitima].front();
+            esc->filas[vitima].pop_front();
+            encontrou = true;
+        }
+        pthread_mutex_unlock(&esc->travas[vitima]);
+    }
+
+    if(!encontrou)
+    {
+        return false;
+    }
+
+    tarefa.funcao(tarefa.arg, id);
+    tarefa.pendentes->fetch_sub(1);
+    return true;
+}
+
+/*
+    AguardarTarefas: espera todas as tarefas do grupo 'pendentes' terminarem (join),
+    executando outras tarefas enquanto isso.
+ */
+void AguardarTarefas(Escalonador *esc, int id, atomic<long> *pendentes)
+{
+    while(pendentes->load() > 0)
+    {
+        if(!ExecutarUmaTarefa(esc, id))
+        {
+            sched_yield();
+        }
+    }
+}
+
+// ============================================================
+//                  MERGE PARALELO COM TAREFAS
+// ============================================================
+/*
+    Estrutura ArgMergeTarefa: argumento de uma tarefa de merge.
+
+    Campos:
+        - esc: escalonador
+        - esq, tam_esq: primeira sequência ordenada
+        - dir, tam_dir: segunda sequência ordenada
+        - destino: onde os tam_esq + tam_dir elementos mesclados são escritos
+ */
+struct ArgMergeTarefa {
+    Escalonador *esc;
+    const int *esq;
+    long tam_esq;
+    const int *dir;
+    long tam_dir;
+    int *destino;
+};
+
+/*
+    MergeTarefas: mescla duas sequências ordenadas, dividindo merges grandes em tarefas.
+
+    Funcionamento:
+        - Abaixo de CORTE_SEQUENCIAL_TAREFAS elementos usa MergeThread
+        - Senão, usa CoRank para achar o ponto da metade da saída em cada sequência,
+          cria uma tarefa para a primeira metade, mescla a segunda e espera a tarefa
+ */
+void MergeTarefas(Escalonador *esc, int id, const int *esq, long tam_esq, const int *dir, long tam_dir, int *destino);
+
+void TarefaMerge(void *arg, int id)
+{
+    ArgMergeTarefa *dados = (ArgMergeTarefa *)arg;
+    MergeTarefas(dados->esc, id, dados->esq, dados->tam_esq, dados->dir, dados->tam_dir, dados->destino);
+    delete dados;
+}
+
+void MergeTarefas(Escalonador *esc, int id, const int *esq, long tam_esq, const int *dir, long tam_dir, int *destino)
+{
+    long total = tam_esq + tam_dir;
+    if(total <= CORTE_SEQUENCIAL_TAREFAS)
+    {
+        MergeThread(esq, tam_esq, dir, tam_dir, destino);
+        return;
+    }
+
+    long k = total / 2;
+    long i = CoRank(k, esq, tam_esq, dir, tam_dir);
+    long j = k - i;
+
+    atomic<long> pendentes(0);
+
+    ArgMergeTarefa *primeira = new ArgMergeTarefa;
+    primeira->esc = esc;
+    primeira->esq = esq;
+    primeira->tam_esq = i;
+    primeira->dir = dir;
+    primeira->tam_dir = j;
+    primeira->destino = destino;
+    CriarTarefa(esc, id, TarefaMerge, primeira, &pendentes);
+
+    MergeTarefas(esc, id, esq + i, tam_esq - i, dir + j, tam_dir - j, destino + k);
+
+    AguardarTarefas(esc, id, &pendentes);
+}
+
+// ============================================================
+//                  ORDENAÇÃO RECURSIVA COM TAREFAS
+// ============================================================
+/*
+    Estrutura ArgOrdenarTarefa: argumento de uma tarefa de ordenação.
+
+    Campos:
+        - esc: escalonador
+        - vetor, auxiliar: os dois buffers, no mesmo intervalo [0, tamanho)
+        - tamanho: número de elementos do intervalo
+        - para_auxiliar: se verdadeiro, o resultado deve terminar em 'auxiliar'; senão em 'vetor'
+ */
+struct ArgOrdenarTarefa {
+    Escalonador *esc;
+    int *vetor;
+    int *auxiliar;
+    long tamanho;
+    bool para_auxiliar;
+};
+
+/*
+    OrdenarTarefas: ordena 'vetor' (tamanho elementos), deixando o resultado em 'vetor'
+    ou em 'auxiliar' conforme para_auxiliar.
+
+    Funcionamento:
+        - Abaixo de CORTE_SEQUENCIAL_TAREFAS usa MergeSortSeqPingPongBuffer e, se o
+          resultado não ficou no buffer pedido, copia
+        - Senão, ordena as duas metades com o resultado no outro buffer (uma delas como
+          nova tarefa) e as mescla no buffer pedido com MergeTarefas
+        - Alternar o buffer de destino a cada nível evita copiar os dados de volta após cada merge
+ */
+void OrdenarTarefas(Escalonador *esc, int id, int *vetor, int *auxiliar, long tamanho, bool para_auxiliar);
+
+void TarefaOrdenar(void *arg, int id)
+{
+    ArgOrdenarTarefa *dados = (ArgOrdenarTarefa *)arg;
+    OrdenarTarefas(dados->esc, id, dados->vetor, dados->auxiliar, dados->tamanho, dados->para_auxiliar);
+    delete dados;
+}
+
+void OrdenarTarefas(Escalonador *esc, int id, int *vetor, int *auxiliar, long tamanho, bool para_auxiliar)
+{
+    if(tamanho <= CORTE_SEQUENCIAL_TAREFAS)
+    {
+        int *resultado = MergeSortSeqPingPongBuffer(vetor, auxiliar, tamanho);
+        int *alvo = para_auxiliar ? auxiliar : vetor;
+        if(resultado != alvo)
+        {
+            memcpy(alvo, resultado, tamanho * sizeof(int));
+        }
+        return;
+    }
+
+    long meio = tamanho / 2;
+    atomic<long> pendentes(0);
+
+    ArgOrdenarTarefa *esquerda = new ArgOrdenarTarefa;
+    esquerda->esc = esc;
+    esquerda->vetor = vetor;
+    esquerda->auxiliar = auxiliar;
+    esquerda->tamanho = meio;
+    esquerda->para_auxiliar = !para_auxiliar;
+    CriarTarefa(esc, id, TarefaOrdenar, esquerda, &pendentes);
+
+    OrdenarTarefas(esc, id, vetor + meio, auxiliar + meio, tamanho - meio, !para_auxiliar);
+
+    AguardarTarefas(esc, id, &pendentes);
+
+    // As metades estão no buffer oposto ao destino
+    int *origem = para_auxiliar ? vetor : auxiliar;
+    int *destino = para_auxiliar ? auxiliar : vetor;
+    MergeTarefas(esc, id, origem, meio, origem + meio, tamanho - meio, destino);
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL MERGE SORT COM TAREFAS
+// ============================================================
+/*
+    Estrutura MergeTarefasContexto: dados da ordenação repassados às threads do pool.
+ */
+struct MergeTarefasContexto {
+    Escalonador *esc;
+    int *vetor;
+    int *auxiliar;
+    long tamanho;
+};
+
+/*
+    TarefaEscalonador: laço executado por cada thread do pool durante uma ordenação.
+
+    Funcionamento:
+        - A thread 0 executa a ordenação raiz e, ao terminar, sinaliza 'terminado'
+        - As demais threads roubam e executam tarefas até o término
+ */
+void TarefaEscalonador(void *arg, int id)
+{
+    MergeTarefasContexto *contexto = (MergeTarefasContexto *)arg;
+    Escalonador *esc = contexto->esc;
+
+    if(id == 0)
+    {
+        OrdenarTarefas(esc, id, contexto->vetor, contexto->auxiliar, contexto->tamanho, false);
+        esc->terminado.store(true);
+        return;
+    }
+
+    while(!esc->terminado.load())
+    {
+        if(!ExecutarUmaTarefa(esc, id))
+        {
+            sched_yield();
+        }
+    }
+}
+
+/*
+    MergeSortTarefasPool: ordena um vetor de inteiros com Merge Sort recursivo em tarefas,
+    usando as threads de um pool já criado.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho: número de elementos no array
+        - pool: pool de threads (CriarPool) que executará as tarefas
+
+    Funcionamento:
+        - Cria as filas do escalonador (uma por thread do pool) e o buffer auxiliar
+        - Executa TarefaEscalonador em todas as threads do pool
+ */
+void MergeSortTarefasPool(int *vetor, long tamanho, PoolThreads *pool)
+{
+    if(tamanho <= 1)
+    {
+        return;
+    }
+
+    Escalonador esc;
+    esc.num_threads = pool->num_threads;
+    esc.filas = new deque<Tarefa>[esc.num_threads];
+    esc.travas = new pthread_mutex_t[esc.num_threads];
+    esc.terminado.store(false);
+    for(int t = 0; t < esc.num_threads; t++)
+    {
+        pthread_mutex_init(&esc.travas[t], NULL);
+    }
+
+    MergeTarefasContexto contexto;
+    contexto.esc = &esc;
+    contexto.vetor = vetor;
+    contexto.auxiliar = new int[tamanho];
+    contexto.tamanho = tamanho;
+
+    ExecutarPool(pool, TarefaEscalonador, &contexto);
+
+    for(int t = 0; t < esc.num_threads; t++)
+    {
+        pthread_mutex_destroy(&esc.travas[t]);
+    }
+    delete[] esc.travas;
+    delete[] esc.filas;
+    delete[] contexto.auxiliar;
+}
+
+/*
+    MergeSortTarefas: igual ao MergeSortTarefasPool, criando um pool temporário com num_threads threads.
+ */
+void MergeSortTarefas(int *vetor, long tamanho, int num_threads)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+    MergeSortTarefasPool(vetor, tamanho, &pool);
+    DestruirPool(&pool);
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecMergeTarefas: executa o Merge Sort com tarefas e roubo de trabalho para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - num_threads: número de threads a serem utilizadas
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Cria o pool de threads uma única vez, fora da região medida
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com MergeSortTarefasPool
+ */
+void ExecMergeTarefas(const char **entradas, int num_entradas, int num_threads, const char *csv_saida, const char *distribuicao)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/threads/merge_tarefas.csv", "MergeSort - Tarefas", num_threads,
+                              [](int *vetor, long tamanho, void *contexto) {
+                                  MergeSortTarefasPool(vetor, tamanho, (PoolThreads *)contexto);
+                              },
+                              &pool);
+
+    DestruirPool(&pool);
+}
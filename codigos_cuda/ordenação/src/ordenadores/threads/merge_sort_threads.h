@@ -12,284 +12,366 @@
 
     O Merge Sort é um algoritmo de ordenação baseado na técnica "dividir para conquistar".
     Esta versão distribui os merges entre múltiplas threads para acelerar o processamento.
+    Cada passada divide a saída em faixas iguais entre as threads usando a partição do
+    merge (merge path), de forma que as últimas passadas, com poucos merges grandes,
+    também usem todas as threads. As threads vêm de um pool persistente (pool_threads.h),
+    criado uma vez por ExecMergeThread, e as passadas são separadas por uma barreira.
+    Antes das passadas de merge, as threads ordenam por inserção blocos de
+    TAMANHO_BLOCO_INICIAL_THREAD elementos, e as passadas começam a partir desse tamanho.
 */
 
+#pragma once
+
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <chrono>
 #include <pthread.h>
 
+#include "pool_threads.h"
+
+#include "../../utils/arquivo_mapeado.h"
+
 using namespace std;
 
+#define TAMANHO_BLOCO_INICIAL_THREAD 32
+
+/*
+    TAMANHO_BLOCO_INICIAL_THREAD: tamanho dos blocos ordenados por inserção antes das passadas de merge.
+        - Substitui as passadas com subvetores de 1, 2, 4, 8 e 16 elementos por uma única
+          passada que ordena cada bloco dentro da cache L1.
+*/
+
 // ============================================================
 //                  Estrutura de dados para threads
 // ============================================================
 /*
-    Estrutura ThreadDados: usada para passar parâmetros para cada thread.
+    Estrutura MergeThreadContexto: dados compartilhados pelas threads do pool durante uma ordenação.
 
     Campos:
         - vetor: ponteiro para o array de inteiros a ser ordenado
-        - inicio_merge: índice do primeiro merge que esta thread deve processar
-        - fim_merge: índice do último merge que esta thread deve processar
-        - tamanho_subvetor: tamanho atual das sublistas a serem mescladas
+        - auxiliar: buffer do mesmo tamanho do vetor, alternado com ele a cada passada
         - tamanho_total: tamanho total do vetor
+        - pool: pool de threads que executa a ordenação (usado para sincronizar as passadas)
+        - resultado: vetor (o original ou o auxiliar) que contém o resultado após a última passada
  */
-struct ThreadDados {
+struct MergeThreadContexto {
     int *vetor;
-    int inicio_merge;
-    int fim_merge;
-    int tamanho_subvetor;
-    int tamanho_total;              
+    int *auxiliar;
+    long tamanho_total;
+    PoolThreads *pool;
+    int *resultado;
 };
 
 // ============================================================
 //                  FUNÇÃO DE MESCLAGEM (MERGE)
 // ============================================================
 /*
-    MergeThread: mescla dois subvetores adjacentes já ordenados em um único segmento ordenado.
+    MergeThread: mescla duas sequências já ordenadas em 'destino'.
 
     Parâmetros:
-        - vetor: ponteiro para o array de inteiros a ser ordenado
-        - começo: índice inicial do primeiro subvetor
-        - meio: índice final do primeiro subvetor
-        - fim: índice final do segundo subvetor
+        - esq, tam_esq: primeira sequência e seu tamanho
+        - dir, tam_dir: segunda sequência e seu tamanho
+        - destino: vetor que recebe os tam_esq + tam_dir elementos mesclados
 
     Funcionamento:
-        - Cria vetores auxiliares para os segmentos esquerdo e direito
-        - Copia os elementos dos subvetores para os auxiliares
-        - Mescla os dois subvetores de volta ao vetor principal, mantendo a ordem
+        - Lê diretamente das sequências de origem e escreve no destino (sem vetores auxiliares)
+        - Em caso de empate escolhe a sequência da esquerda, mantendo a ordenação estável
  */
-void MergeThread(int *vetor, int começo, int meio, int fim){
-    int tam_esquerda = meio - começo + 1;
-    int tam_direita = fim - meio;
-
-    int *vet_esq = new int[tam_esquerda];
-    int *vet_dir = new int[tam_direita];
-
-    // Copia elementos para os vetores auxiliares
-    int idx_esq = 0;
-    while(idx_esq < tam_esquerda){
-        vet_esq[idx_esq] = vetor[começo + idx_esq];
-        idx_esq++;
-    }
-    
-    int idx_dir = 0;
-    while(idx_dir < tam_direita){
-        vet_dir[idx_dir] = vetor[meio + 1 + idx_dir];
-        idx_dir++;
-    }
+void MergeThread(const int *esq, long tam_esq, const int *dir, long tam_dir, int *destino)
+{
+    long idx_esq = 0;
+    long idx_dir = 0;
+    long idx = 0;
 
-    // Mescla os vetores auxiliares de volta ao vetor principal
-    idx_esq = 0;
-    idx_dir = 0;
-    int idx = começo;
-    while(idx_esq < tam_esquerda && idx_dir < tam_direita){
-        if(vet_esq[idx_esq] <= vet_dir[idx_dir]){
-            vetor[idx] = vet_esq[idx_esq];
-            idx_esq++;
+    while(idx_esq < tam_esq && idx_dir < tam_dir){
+        if(esq[idx_esq] <= dir[idx_dir]){
+            destino[idx++] = esq[idx_esq++];
         } else {
-            vetor[idx] = vet_dir[idx_dir];
-            idx_dir++;
+            destino[idx++] = dir[idx_dir++];
         }
-        idx++;
     }
 
     // Copia o restante dos elementos, se houver
-    while(idx_esq < tam_esquerda){
-        vetor[idx] = vet_esq[idx_esq];
-        idx_esq++;
-        idx++;
+    while(idx_esq < tam_esq){
+        destino[idx++] = esq[idx_esq++];
     }
 
-    while(idx_dir < tam_direita){
-        vetor[idx] = vet_dir[idx_dir];
-        idx_dir++;
-        idx++;
+    while(idx_dir < tam_dir){
+        destino[idx++] = dir[idx_dir++];
     }
-
-    delete[] vet_esq;
-    delete[] vet_dir;
 }
 
 // ============================================================
-//                  FUNÇÃO DE TRABALHO DAS THREADS
+//                  PARTIÇÃO DO MERGE (MERGE PATH)
 // ============================================================
 /*
-    ThreadMergeWorker: função executada por cada thread para processar uma faixa de merges.
+    CoRank: encontra quantos elementos de 'esq' estão entre os k primeiros elementos do
+    merge estável de 'esq' com 'dir'.
 
     Parâmetros:
-        - arg: ponteiro para estrutura ThreadDados contendo os parâmetros da thread
+        - k: posição de saída (0..tam_esq + tam_dir)
+        - esq, tam_esq: primeira sequência ordenada e seu tamanho
+        - dir, tam_dir: segunda sequência ordenada e seu tamanho
+
+    Retorno:
+        - i tal que as k primeiras saídas são esq[0..i) e dir[0..k-i)
 
     Funcionamento:
-        * Para cada merge atribuído à thread:
-        - Calcula os indices dos subvetores a serem mesclados
-        - Chama MergeThread para realizar a mesclagem
+        - Busca binária no "caminho do merge": esq[i] pertence às k primeiras saídas
+          se esq[i] <= dir[k-i-1] (empates vão para a esquerda, como em MergeThread)
+        - Permite que várias threads mesclem partes disjuntas da saída de um único merge,
+          cada uma começando e terminando em posições calculadas de forma independente
  */
-void* ThreadMergeWorker(void *arg)
+long CoRank(long k, const int *esq, long tam_esq, const int *dir, long tam_dir)
 {
-    ThreadDados *dados = (ThreadDados *)arg;
-    
-    int idx_merge = dados->inicio_merge;
-    while(idx_merge < dados->fim_merge)
+    long baixo = max(0L, k - tam_dir);
+    long alto = min(k, tam_esq);
+
+    while(baixo < alto)
     {
-        int começo = idx_merge * dados->tamanho_subvetor * 2;
-        
-        if(começo >= dados->tamanho_total - 1)
+        long i = (baixo + alto) / 2;
+        if(esq[i] <= dir[k - i - 1])
         {
-            break;
+            baixo = i + 1;
+        } else {
+            alto = i;
         }
-            
-        int meio = min(começo + dados->tamanho_subvetor - 1, dados->tamanho_total - 1);
-        int fim = min(começo + 2 * dados->tamanho_subvetor - 1, dados->tamanho_total - 1);
-        
-        if(meio < fim)
+    }
+
+    return baixo;
+}
+
+// ============================================================
+//           FUNÇÃO DE ORDENAÇÃO DOS BLOCOS INICIAIS
+// ============================================================
+/*
+    InsertionSortThread: ordena o intervalo [começo, fim) do vetor usando Insertion Sort.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros
+        - começo: índice inicial do intervalo
+        - fim: índice final (exclusivo) do intervalo
+ */
+void InsertionSortThread(int *vetor, long começo, long fim)
+{
+    for(long i = começo + 1; i < fim; i++)
+    {
+        int valor = vetor[i];
+        long j = i - 1;
+        while(j >= começo && vetor[j] > valor)
         {
-            MergeThread(dados->vetor, começo, meio, fim);
+            vetor[j + 1] = vetor[j];
+            j--;
         }
-        
-        idx_merge++;
+        vetor[j + 1] = valor;
     }
-    
-    delete dados;
-    pthread_exit(0);
 }
 
 // ============================================================
-//                  FUNÇÃO PRINCIPAL MERGE SORT COM THREADS
+//                  FUNÇÃO DE TRABALHO DAS THREADS
 // ============================================================
 /*
-    MergeSortThread: ordena um vetor de inteiros usando o algoritmo Merge Sort iterativo (bottom-up) com threads.
+    MergeFaixaThread: produz as posições [inicio, fim) da saída de uma passada.
 
     Parâmetros:
-        - vetor: ponteiro para o array de inteiros a ser ordenado
-        - tamanho_total: número de elementos no array
-        - num_threads: número de threads a serem utilizadas
+        - origem: vetor lido na passada
+        - destino: vetor escrito na passada
+        - inicio, fim: faixa de posições de saída desta thread
+        - tamanho_subvetor: tamanho atual das sublistas a serem mescladas
+        - tamanho_total: tamanho total do vetor
 
     Funcionamento:
-        * Para cada tamanho de subvetor (1, 2, 4, ...):
-        - Divide os merges entre as threads disponíveis
-        - Cada thread processa uma faixa de merges
-        - Aguarda todas as threads terminarem antes de dobrar o tamanho dos subvetores
+        * Percorre as posições de saída [inicio, fim). Para cada merge da passada
+          que intercepta essa faixa:
+        - Calcula os índices dos subvetores a serem mesclados
+        - Usa CoRank para achar onde a parte da thread começa e termina em cada subvetor
+        - Chama MergeThread apenas para essa parte
+        - Assim um único merge grande (como o da última passada) é dividido entre todas as
+          threads, e várias merges pequenas podem ser feitas por uma única thread
  */
-void MergeSortThread(int *vetor, int tamanho_total, int num_threads)
+void MergeFaixaThread(const int *origem, int *destino, long inicio, long fim_faixa,
+                      long tamanho_subvetor, long tamanho_total)
 {
-    if(tamanho_total <= 1)
+    long tamanho_merge = tamanho_subvetor * 2;
+    long posicao = inicio;
+
+    while(posicao < fim_faixa)
     {
-        return;
+        long começo = (posicao / tamanho_merge) * tamanho_merge;
+        long meio = min(começo + tamanho_subvetor, tamanho_total);
+        long fim = min(começo + tamanho_merge, tamanho_total);
+
+        const int *esq = origem + começo;
+        const int *dir = origem + meio;
+        long tam_esq = meio - começo;
+        long tam_dir = fim - meio;
+
+        // Parte da saída deste merge que pertence à thread, relativa ao começo do merge
+        long k_inicio = posicao - começo;
+        long k_fim = min(fim, fim_faixa) - começo;
+
+        long i_inicio = CoRank(k_inicio, esq, tam_esq, dir, tam_dir);
+        long i_fim = CoRank(k_fim, esq, tam_esq, dir, tam_dir);
+        long j_inicio = k_inicio - i_inicio;
+        long j_fim = k_fim - i_fim;
+
+        MergeThread(esq + i_inicio, i_fim - i_inicio, dir + j_inicio, j_fim - j_inicio,
+                    destino + posicao);
+
+        posicao = começo + k_fim;
     }
-    
-    int tamanho_subvetor = 1;
-    while(tamanho_subvetor < tamanho_total)
+}
+
+/*
+    TarefaMergeSortThread: tarefa executada por cada thread do pool para ordenar o vetor inteiro.
+
+    Parâmetros:
+        - arg: ponteiro para o MergeThreadContexto da ordenação
+        - id: índice da thread no pool
+
+    Funcionamento:
+        - Ordena com InsertionSortThread os blocos iniciais da sua faixa (alinhada aos blocos)
+        * Para cada tamanho de subvetor (TAMANHO_BLOCO_INICIAL_THREAD, 2x, 4x, ...):
+        - Espera as demais threads terminarem a passada anterior (SincronizarPool)
+        - Produz a sua faixa da saída com MergeFaixaThread e troca origem e destino
+        - Todas as threads percorrem as mesmas passadas, então origem e destino ficam
+          iguais em todas elas
+ */
+void TarefaMergeSortThread(void *arg, int id)
+{
+    MergeThreadContexto *contexto = (MergeThreadContexto *)arg;
+    long tamanho_total = contexto->tamanho_total;
+    long num_threads = contexto->pool->num_threads;
+
+    // Ordena os blocos iniciais da faixa desta thread
+    long total_blocos = (tamanho_total + TAMANHO_BLOCO_INICIAL_THREAD - 1) / TAMANHO_BLOCO_INICIAL_THREAD;
+    long inicio_blocos = min((total_blocos * id) / num_threads * TAMANHO_BLOCO_INICIAL_THREAD, tamanho_total);
+    long fim_blocos = min((total_blocos * (id + 1)) / num_threads * TAMANHO_BLOCO_INICIAL_THREAD, tamanho_total);
+
+    for(long começo = inicio_blocos; começo < fim_blocos; começo += TAMANHO_BLOCO_INICIAL_THREAD)
     {
-        int total_merges = (tamanho_total + (tamanho_subvetor * 2 - 1)) / (tamanho_subvetor * 2);
-        int threads_usadas = min(num_threads, total_merges);
-        
-        pthread_t *threads = new pthread_t[threads_usadas];
-        
-        for(int t = 0; t < threads_usadas; t++)
-        {
-            ThreadDados *dados = new ThreadDados;
-            dados->vetor = vetor;
-            dados->tamanho_subvetor = tamanho_subvetor;
-            dados->tamanho_total = tamanho_total;
-            dados->inicio_merge = (total_merges * t) / threads_usadas;
-            dados->fim_merge = (total_merges * (t + 1)) / threads_usadas;
-            
-            pthread_create(&threads[t], NULL, ThreadMergeWorker, dados);
-        }
-        
-        for(int t = 0; t < threads_usadas; t++)
-        {
-            pthread_join(threads[t], NULL);
-        }
-        
-        delete[] threads;
-        tamanho_subvetor *= 2;
+        InsertionSortThread(contexto->vetor, começo, min(começo + TAMANHO_BLOCO_INICIAL_THREAD, fim_blocos));
+    }
+
+    // Faixa de saída desta thread em todas as passadas
+    long inicio = (tamanho_total * id) / num_threads;
+    long fim = (tamanho_total * (id + 1)) / num_threads;
+
+    int *origem = contexto->vetor;
+    int *destino = contexto->auxiliar;
+
+    for(long tamanho_subvetor = TAMANHO_BLOCO_INICIAL_THREAD; tamanho_subvetor < tamanho_total; tamanho_subvetor *= 2)
+    {
+        SincronizarPool(contexto->pool);
+
+        MergeFaixaThread(origem, destino, inicio, fim, tamanho_subvetor, tamanho_total);
+
+        int *temp = origem;
+        origem = destino;
+        destino = temp;
+    }
+
+    if(id == 0)
+    {
+        contexto->resultado = origem;
     }
 }
+
 // ============================================================
-//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+//                  FUNÇÃO PRINCIPAL MERGE SORT COM THREADS
 // ============================================================
 /*
-    ExecMergeThread: executa o Merge Sort com threads para múltiplos arquivos binários
-    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+    MergeSortThreadPool: ordena um vetor de inteiros usando o algoritmo Merge Sort iterativo (bottom-up)
+    com as threads de um pool já criado.
 
     Parâmetros:
-        - entradas: array de caminhos (const char*) para arquivos binários
-        - num_entradas: número de entradas no array
-        - num_threads: número de threads a serem utilizadas
-        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho_total: número de elementos no array
+        - pool: pool de threads (CriarPool) que executará a ordenação
 
     Funcionamento:
-        * Para cada arquivo:
-        - Abre o arquivo e determina o número de inteiros
-        - Lê os dados para um vetor alocado dinamicamente
-        - Mede o tempo de ordenação usando chrono
-        - Ordena os dados com MergeSortThread
-        - Registra o tempo no arquivo CSV
-        - Regrava o arquivo com os dados ordenados
-        - Libera memória utilizada
+        - Aloca um único buffer auxiliar, alternado com o vetor a cada passada (ping-pong)
+        - Executa TarefaMergeSortThread em todas as threads do pool: cada thread ordena
+          por inserção os blocos iniciais da sua faixa e, em cada passada, produz uma faixa
+          de mesmo tamanho da saída (merge path), com uma barreira entre as passadas
+        - Se o resultado final ficou no buffer auxiliar, copia de volta para o vetor
  */
-void ExecMergeThread(const char **entradas, int num_entradas, int num_threads, const char *csv_saida)
+void MergeSortThreadPool(int *vetor, long tamanho_total, PoolThreads *pool)
 {
-    FILE *csv = fopen(csv_saida, "a");
-    FILE *thread_merge_csv = fopen("results/threads/merge_thread.csv", "a");
-    if (!csv || !thread_merge_csv)
+    if(tamanho_total <= 1)
     {
-        perror("Erro ao abrir arquivos de saída CSV");
         return;
     }
 
-    fprintf(thread_merge_csv, "Tamanho,Tempo\n");
+    MergeThreadContexto contexto;
+    contexto.vetor = vetor;
+    contexto.auxiliar = new int[tamanho_total];
+    contexto.tamanho_total = tamanho_total;
+    contexto.pool = pool;
 
-    for(int i = 0; i < num_entradas; i++)
+    ExecutarPool(pool, TarefaMergeSortThread, &contexto);
+
+    if(contexto.resultado != vetor)
     {
-        FILE *file = fopen(entradas[i], "rb+");
-        if(!file)
-        {
-            perror(entradas[i]);
-            return;
-        }
+        memcpy(vetor, contexto.resultado, tamanho_total * sizeof(int));
+    }
 
-        fseek(file, 0, SEEK_END);
-        long tamanho = ftell(file) / sizeof(int);
-        fseek(file, 0, SEEK_SET);
+    delete[] contexto.auxiliar;
+}
 
-        int *v = new int[tamanho];
-        if(fread(v, sizeof(int), tamanho, file) != (size_t)tamanho)
-        {
-            perror("Erro ao ler o arquivo");
-            fclose(file);
-            delete[] v;
-            continue;
-        }
+/*
+    MergeSortThread: ordena um vetor de inteiros usando o algoritmo Merge Sort iterativo (bottom-up) com threads.
 
-        auto start = chrono::high_resolution_clock::now();
-        MergeSortThread(v, tamanho, num_threads);
-        auto end = chrono::high_resolution_clock::now();
-        chrono::duration<double> elapsed = end - start;
-        double tempo = elapsed.count();
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho_total: número de elementos no array
+        - num_threads: número de threads a serem utilizadas
 
-        printf("MergeSort Threads - Tempo para ordenar %s: %f s\n", entradas[i], tempo);
+    Funcionamento:
+        - Cria um pool temporário com num_threads threads, ordena com MergeSortThreadPool
+          e destrói o pool. Para ordenar vários vetores, prefira criar o pool uma vez e
+          chamar MergeSortThreadPool diretamente (como em ExecMergeThread).
+ */
+void MergeSortThread(int *vetor, long tamanho_total, int num_threads)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+    MergeSortThreadPool(vetor, tamanho_total, &pool);
+    DestruirPool(&pool);
+}
 
-        fprintf(csv, "MergeSort - Threads,%ld,%f\n", tamanho, tempo);
-        fprintf(thread_merge_csv, "%ld,%f\n", tamanho, tempo);
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecMergeThread: executa o Merge Sort com threads para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
 
-        fseek(file, 0, SEEK_SET);
-        if(fwrite(v, sizeof(int), tamanho, file) != (size_t)tamanho)
-        {
-            perror("Erro ao escrever no arquivo");
-            fclose(file);
-            delete[] v;
-            continue;
-        }
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - num_threads: número de threads a serem utilizadas
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
 
-        fclose(file);
-        delete[] v;
-    }
+    Funcionamento:
+        - Cria o pool de threads uma única vez, fora da região medida
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com MergeSortThreadPool
+ */
+void ExecMergeThread(const char **entradas, int num_entradas, int num_threads, const char *csv_saida, const char *distribuicao)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/threads/merge_thread.csv", "MergeSort - Threads", num_threads,
+                              [](int *vetor, long tamanho, void *contexto) {
+                                  MergeSortThreadPool(vetor, tamanho, (PoolThreads *)contexto);
+                              },
+                              &pool);
 
-    fclose(csv);
-    fclose(thread_merge_csv);
-}
\ No newline at end of file
+    DestruirPool(&pool);
+}
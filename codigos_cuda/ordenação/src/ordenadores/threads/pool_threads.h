@@ -0,0 +1,178 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa um conjunto (pool) de threads POSIX persistentes, reutilizado
+    pelas ordenações com threads.
+    O fluxo geral é:
+        1. CriarPool cria as threads uma única vez; elas ficam bloqueadas esperando trabalho
+        2. ExecutarPool entrega uma tarefa a todas as threads e espera que terminem
+        3. Dentro da tarefa, SincronizarPool funciona como barreira entre as threads
+           (por exemplo, entre as passadas de uma ordenação)
+        4. DestruirPool encerra e aguarda as threads
+
+    Criar e aguardar threads a cada passada (pthread_create/pthread_join) custa dezenas de
+    microssegundos por thread. Com o pool esse custo é pago uma vez, fora da região medida.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "../../utils/medicao.h"
+
+// ============================================================
+//                  Estrutura do pool de threads
+// ============================================================
+/*
+    Estrutura PoolThreads: estado compartilhado entre o pool e suas threads.
+
+    Campos:
+        - num_threads: número de threads trabalhadoras
+        - threads: identificadores das threads
+        - inicio: barreira (threads + chamador) que libera uma nova tarefa
+        - fim: barreira (threads + chamador) que marca o fim da tarefa
+        - sincronizacao: barreira apenas entre as threads, usada dentro das tarefas
+        - tarefa: função executada por cada thread, recebendo o contexto e o id da thread
+        - contexto: ponteiro repassado à tarefa
+        - encerrar: quando verdadeiro, as threads saem ao serem liberadas
+ */
+struct PoolThreads {
+    int num_threads;
+    pthread_t *threads;
+    pthread_barrier_t inicio;
+    pthread_barrier_t fim;
+    pthread_barrier_t sincronizacao;
+    void (*tarefa)(void *contexto, int id);
+    void *contexto;
+    bool encerrar;
+};
+
+/*
+    Estrutura PoolThreadArg: argumento de cada thread do pool (o pool e o id da thread).
+ */
+struct PoolThreadArg {
+    PoolThreads *pool;
+    int id;
+};
+
+// ============================================================
+//                  FUNÇÃO DE TRABALHO DAS THREADS
+// ============================================================
+/*
+    PoolWorker: laço executado por cada thread do pool.
+
+    Funcionamento:
+        - Espera na barreira 'inicio' até receber uma tarefa (ou o pedido de encerramento)
+        - Executa a tarefa com o seu id
+        - Espera na barreira 'fim', liberando o chamador quando todas terminarem
+ */
+void* PoolWorker(void *arg)
+{
+    PoolThreadArg *dados = (PoolThreadArg *)arg;
+    PoolThreads *pool = dados->pool;
+    int id = dados->id;
+    delete dados;
+
+    while(true)
+    {
+        pthread_barrier_wait(&pool->inicio);
+        if(pool->encerrar)
+        {
+            break;
+        }
+
+        pool->tarefa(pool->contexto, id);
+
+        pthread_barrier_wait(&pool->fim);
+    }
+
+    pthread_exit(0);
+}
+
+// ============================================================
+//                  FUNÇÕES DE CONTROLE DO POOL
+// ============================================================
+/*
+    CriarPool: inicializa o pool e cria as suas threads.
+
+    Parâmetros:
+        - pool: pool a ser inicializado
+        - num_threads: número de threads trabalhadoras (mínimo 1)
+
+    Funcionamento:
+        - Com config_medicao.fixar_threads, a thread t é fixada no núcleo t (FixarThread)
+ */
+void CriarPool(PoolThreads *pool, int num_threads)
+{
+    if(num_threads < 1)
+    {
+        num_threads = 1;
+    }
+
+    pool->num_threads = num_threads;
+    pool->threads = new pthread_t[num_threads];
+    pool->tarefa = NULL;
+    pool->contexto = NULL;
+    pool->encerrar = false;
+
+    pthread_barrier_init(&pool->inicio, NULL, num_threads + 1);
+    pthread_barrier_init(&pool->fim, NULL, num_threads + 1);
+    pthread_barrier_init(&pool->sincronizacao, NULL, num_threads);
+
+    for(int t = 0; t < num_threads; t++)
+    {
+        PoolThreadArg *arg = new PoolThreadArg;
+        arg->pool = pool;
+        arg->id = t;
+        pthread_create(&pool->threads[t], NULL, PoolWorker, arg);
+        FixarThread(pool->threads[t], t);
+    }
+}
+
+/*
+    ExecutarPool: executa 'tarefa(contexto, id)' em todas as threads do pool e espera o término.
+
+    Parâmetros:
+        - pool: pool criado com CriarPool
+        - tarefa: função executada por cada thread (id de 0 a num_threads-1)
+        - contexto: ponteiro repassado à tarefa
+ */
+void ExecutarPool(PoolThreads *pool, void (*tarefa)(void *contexto, int id), void *contexto)
+{
+    pool->tarefa = tarefa;
+    pool->contexto = contexto;
+
+    pthread_barrier_wait(&pool->inicio);
+    pthread_barrier_wait(&pool->fim);
+}
+
+/*
+    SincronizarPool: barreira entre as threads do pool; deve ser chamada por todas as threads
+    dentro da mesma tarefa, o mesmo número de vezes.
+ */
+void SincronizarPool(PoolThreads *pool)
+{
+    pthread_barrier_wait(&pool->sincronizacao);
+}
+
+/*
+    DestruirPool: encerra as threads do pool, aguarda o término e libera os recursos.
+ */
+void DestruirPool(PoolThreads *pool)
+{
+    pool->encerrar = true;
+    pthread_barrier_wait(&pool->inicio);
+
+    for(int t = 0; t < pool->num_threads; t++)
+    {
+        pthread_join(pool->threads[t], NULL);
+    }
+
+    pthread_barrier_destroy(&pool->inicio);
+    pthread_barrier_destroy(&pool->fim);
+    pthread_barrier_destroy(&pool->sincronizacao);
+    delete[] pool->threads;
+}
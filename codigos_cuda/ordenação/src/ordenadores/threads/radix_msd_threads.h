@@ -0,0 +1,286 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o Radix Sort MSD no próprio lugar (American flag sort) de forma
+    paralela na CPU, usando o pool de threads POSIX.
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Ordenar os dados usando Radix Sort MSD com threads, sem buffer auxiliar
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com os dados ordenados
+        5. Registrar tempos em CSV
+
+    Apenas o primeiro nível é dividido entre as threads:
+        - Contagem: cada thread conta os dígitos da sua faixa do vetor; se todos os elementos
+          têm o mesmo dígito, a contagem é refeita com o dígito seguinte
+        - Permutação: a thread 0 permuta os elementos nos baldes no próprio lugar
+          (PermutarBaldesMSD); é a única etapa sequencial, uma leitura e uma escrita do vetor
+        - Ordenação dos baldes: os baldes são independentes, e cada thread pega o próximo
+          balde ainda não ordenado (do maior para o menor) e o ordena com RadixSortMSDNivel
+
+    Como no RadixSortMSD, além dos histogramas nenhuma memória proporcional à entrada é
+    alocada. O equilíbrio depende dos tamanhos dos baldes: com 256 baldes e os maiores
+    distribuídos primeiro, as threads terminam juntas, a não ser que um único balde concentre
+    boa parte dos elementos (como na zipf).
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <algorithm>
+
+#include "pool_threads.h"
+#include "../sequencial/radix_sort_msd.h"
+
+#include "../../utils/arquivo_mapeado.h"
+
+using namespace std;
+
+#define RADIX_MSD_MINIMO_THREADS 65536
+
+/*
+    RADIX_MSD_MINIMO_THREADS: vetores menores são ordenados sequencialmente com RadixSortMSD,
+        pois a sincronização das threads custaria mais que a ordenação.
+*/
+
+// ============================================================
+//                  Estrutura de dados para threads
+// ============================================================
+/*
+    Enum EstadoRadixMSD: decisão da thread 0 depois de cada contagem do primeiro nível.
+        - RADIX_MSD_PERMUTADO: os elementos foram permutados nos baldes, que podem ser ordenados
+        - RADIX_MSD_PROXIMO_DIGITO: todos têm o mesmo dígito; conta o dígito seguinte
+        - RADIX_MSD_ORDENADO: todos os elementos são iguais
+ */
+enum EstadoRadixMSD {
+    RADIX_MSD_PERMUTADO,
+    RADIX_MSD_PROXIMO_DIGITO,
+    RADIX_MSD_ORDENADO
+};
+
+/*
+    Estrutura RadixMSDContexto: dados compartilhados pelas threads do pool durante uma ordenação.
+
+    Campos:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho: número de elementos do vetor
+        - num_threads: número de threads do pool
+        - histogramas: matriz [num_threads][RADIX_MSD_BALDES] de contagens
+        - count: contagem total de cada dígito do primeiro nível
+        - inicio: posição inicial de cada balde do primeiro nível
+        - ordem: dígitos dos baldes, do maior para o menor
+        - deslocamento: deslocamento do dígito do primeiro nível
+        - estado: decisão da thread 0 após a contagem (EstadoRadixMSD)
+        - proximo_balde: próxima posição de 'ordem' a ser ordenada
+        - pool: pool de threads que executa a ordenação
+ */
+struct RadixMSDContexto {
+    int *vetor;
+    long tamanho;
+    int num_threads;
+    long *histogramas;
+    long count[RADIX_MSD_BALDES];
+    long inicio[RADIX_MSD_BALDES + 1];
+    int ordem[RADIX_MSD_BALDES];
+    int deslocamento;
+    EstadoRadixMSD estado;
+    atomic<int> proximo_balde;
+    PoolThreads *pool;
+};
+
+// ============================================================
+//                  FUNÇÃO DE TRABALHO DAS THREADS
+// ============================================================
+/*
+    TarefaRadixMSD: tarefa executada por cada thread do pool.
+
+    Parâmetros:
+        - arg: ponteiro para o RadixMSDContexto da ordenação
+        - id: índice da thread no pool
+
+    Funcionamento:
+        - Conta os dígitos da sua faixa e espera todas as threads (SincronizarPool)
+        - A thread 0 soma os histogramas e decide: se todos os elementos têm o mesmo dígito,
+          passa para o próximo dígito (ou termina, se era o último); senão permuta os
+          elementos nos baldes e ordena os baldes por tamanho
+        - Depois de mais uma sincronização, todas as threads seguem a decisão; na ordenação
+          dos baldes, cada uma pega o próximo balde com proximo_balde até acabarem
+ */
+void TarefaRadixMSD(void *arg, int id)
+{
+    RadixMSDContexto *contexto = (RadixMSDContexto *)arg;
+    long *histograma = contexto->histogramas + (long)id * RADIX_MSD_BALDES;
+
+    long inicio = (contexto->tamanho * id) / contexto->num_threads;
+    long fim = (contexto->tamanho * (id + 1)) / contexto->num_threads;
+
+    while (true)
+    {
+        // Contagem dos dígitos da faixa desta thread
+        int deslocamento = contexto->deslocamento;
+        memset(histograma, 0, RADIX_MSD_BALDES * sizeof(long));
+        for (long i = inicio; i < fim; i++)
+        {
+            histograma[DigitoMSD(contexto->vetor[i], deslocamento)]++;
+        }
+
+        SincronizarPool(contexto->pool);
+
+        if (id == 0)
+        {
+            bool trivial = false;
+            for (int d = 0; d < RADIX_MSD_BALDES; d++)
+            {
+                long soma = 0;
+                for (int t = 0; t < contexto->num_threads; t++)
+                {
+                    soma += contexto->histogramas[(long)t * RADIX_MSD_BALDES + d];
+                }
+                contexto->count[d] = soma;
+                trivial = trivial || soma == contexto->tamanho;
+            }
+
+            if (trivial)
+            {
+                contexto->estado = deslocamento == 0 ? RADIX_MSD_ORDENADO : RADIX_MSD_PROXIMO_DIGITO;
+                contexto->deslocamento = deslocamento - RADIX_MSD_BITS;
+            }
+            else
+            {
+                PermutarBaldesMSD(contexto->vetor, contexto->count, deslocamento, contexto->inicio);
+
+                for (int d = 0; d < RADIX_MSD_BALDES; d++)
+                {
+                    contexto->ordem[d] = d;
+                }
+                const long *count = contexto->count;
+                sort(contexto->ordem, contexto->ordem + RADIX_MSD_BALDES,
+                     [count](int a, int b) { return count[a] > count[b]; });
+
+                contexto->proximo_balde.store(0);
+                contexto->estado = RADIX_MSD_PERMUTADO;
+            }
+        }
+
+        SincronizarPool(contexto->pool);
+
+        if (contexto->estado == RADIX_MSD_ORDENADO)
+        {
+            return;
+        }
+        if (contexto->estado == RADIX_MSD_PERMUTADO)
+        {
+            break;
+        }
+    }
+
+    // Ordenação dos baldes do primeiro nível, distribuídos dinamicamente
+    int deslocamento = contexto->deslocamento;
+    if (deslocamento == 0)
+    {
+        return;
+    }
+
+    while (true)
+    {
+        int posicao = contexto->proximo_balde.fetch_add(1);
+        if (posicao >= RADIX_MSD_BALDES)
+        {
+            break;
+        }
+
+        int d = contexto->ordem[posicao];
+        if (contexto->count[d] <= 1)
+        {
+            break; // os baldes seguintes são ainda menores
+        }
+        RadixSortMSDNivel(contexto->vetor + contexto->inicio[d], contexto->count[d], deslocamento - RADIX_MSD_BITS);
+    }
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL RADIX SORT MSD COM THREADS
+// ============================================================
+/*
+    RadixSortMSDThreadPool: ordena um vetor de inteiros (incluindo negativos) com o Radix Sort
+    MSD no próprio lugar, usando as threads de um pool.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho: número de elementos no array
+        - pool: pool de threads (CriarPool) que executará a ordenação
+
+    Funcionamento:
+        - Vetores com menos de RADIX_MSD_MINIMO_THREADS elementos usam RadixSortMSD
+        - Senão, executa TarefaRadixMSD em todas as threads do pool
+ */
+void RadixSortMSDThreadPool(int *vetor, long tamanho, PoolThreads *pool)
+{
+    if (tamanho < RADIX_MSD_MINIMO_THREADS || pool->num_threads == 1)
+    {
+        RadixSortMSD(vetor, tamanho);
+        return;
+    }
+
+    RadixMSDContexto contexto;
+    contexto.vetor = vetor;
+    contexto.tamanho = tamanho;
+    contexto.num_threads = pool->num_threads;
+    contexto.histogramas = new long[(long)pool->num_threads * RADIX_MSD_BALDES];
+    contexto.deslocamento = 32 - RADIX_MSD_BITS;
+    contexto.estado = RADIX_MSD_PROXIMO_DIGITO;
+    contexto.proximo_balde.store(0);
+    contexto.pool = pool;
+
+    ExecutarPool(pool, TarefaRadixMSD, &contexto);
+
+    delete[] contexto.histogramas;
+}
+
+/*
+    RadixSortMSDThread: igual ao RadixSortMSDThreadPool, criando um pool temporário com num_threads threads.
+ */
+void RadixSortMSDThread(int *vetor, long tamanho, int num_threads)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+    RadixSortMSDThreadPool(vetor, tamanho, &pool);
+    DestruirPool(&pool);
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecRadixMSDThread: executa o Radix Sort MSD no próprio lugar com threads para múltiplos
+    arquivos binários contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - num_threads: número de threads a serem utilizadas
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Cria o pool de threads uma única vez, fora da região medida
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com RadixSortMSDThreadPool
+ */
+void ExecRadixMSDThread(const char **entradas, int num_entradas, int num_threads, const char *csv_saida, const char *distribuicao)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/threads/radix_msd_thread.csv", "RadixSort MSD - Threads (no lugar)", num_threads,
+                              [](int *vetor, long tamanho, void *contexto) {
+                                  RadixSortMSDThreadPool(vetor, tamanho, (PoolThreads *)contexto);
+                              },
+                              &pool);
+
+    DestruirPool(&pool);
+}
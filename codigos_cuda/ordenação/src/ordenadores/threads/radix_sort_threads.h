@@ -0,0 +1,230 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o algoritmo Radix Sort LSD de forma paralela na CPU usando threads POSIX.
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Ordenar os dados usando Radix Sort (base 256) com threads
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com os dados ordenados
+        5. Registrar tempos em CSV
+
+    Cada passada processa um dígito de 8 bits (um byte) da chave, do menos para o mais
+    significativo, em três fases separadas por barreiras:
+        - Histograma local: cada thread conta os dígitos da sua faixa do vetor
+        - Soma de prefixos global: a partir dos histogramas de todas as threads, cada thread
+          calcula a posição inicial de cada dígito da sua faixa no vetor de saída
+        - Distribuição (scatter): cada thread copia sua faixa para o vetor de saída, em ordem,
+          o que mantém a ordenação estável entre as passadas
+*/
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <pthread.h>
+
+#include "../../utils/arquivo_mapeado.h"
+
+using namespace std;
+
+#define RADIX_BITS_THREAD 8
+#define RADIX_BALDES_THREAD (1 << RADIX_BITS_THREAD)
+#define RADIX_SINAL_THREAD 0x80000000u
+
+/*
+    RADIX_BITS_THREAD: quantidade de bits da chave processados por passada.
+        - Com 8 bits são necessárias 4 passadas para um int de 32 bits.
+    RADIX_BALDES_THREAD: quantidade de valores possíveis de um dígito (2^RADIX_BITS_THREAD).
+    RADIX_SINAL_THREAD: bit de sinal do int, invertido na extração dos dígitos para que os
+        negativos fiquem antes dos positivos.
+*/
+
+// ============================================================
+//                  Estrutura de dados para threads
+// ============================================================
+/*
+    Estrutura RadixThreadDados: usada para passar parâmetros para cada thread.
+
+    Campos:
+        - id: índice da thread (0..num_threads-1)
+        - num_threads: número total de threads participando da ordenação
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - auxiliar: buffer do mesmo tamanho do vetor, alternado com ele a cada passada
+        - inicio: índice inicial (inclusivo) da faixa desta thread
+        - fim: índice final (exclusivo) da faixa desta thread
+        - histogramas: matriz compartilhada [num_threads][RADIX_BALDES_THREAD] de contagens
+        - barreira: barreira que sincroniza as fases de cada passada
+ */
+struct RadixThreadDados {
+    int id;
+    int num_threads;
+    int *vetor;
+    int *auxiliar;
+    long inicio;
+    long fim;
+    long *histogramas;
+    pthread_barrier_t *barreira;
+};
+
+// ============================================================
+//                  FUNÇÃO DE TRABALHO DAS THREADS
+// ============================================================
+/*
+    ThreadRadixWorker: função executada por cada thread em todas as passadas do Radix Sort.
+
+    Parâmetros:
+        - arg: ponteiro para estrutura RadixThreadDados contendo os parâmetros da thread
+
+    Funcionamento:
+        * Para cada dígito de 8 bits (deslocamento 0, 8, 16, 24):
+        - Conta os dígitos da sua faixa no histograma local
+        - Espera todas as threads terminarem a contagem (barreira)
+        - Calcula a posição inicial de cada dígito: todos os elementos de dígitos menores
+          (de todas as threads) mais os elementos do mesmo dígito das threads anteriores
+        - Distribui os elementos da sua faixa no vetor de destino, na ordem original
+        - Espera todas as threads terminarem a distribuição antes de trocar origem e destino
+ */
+void* ThreadRadixWorker(void *arg)
+{
+    RadixThreadDados *dados = (RadixThreadDados *)arg;
+
+    int *origem = dados->vetor;
+    int *destino = dados->auxiliar;
+    long *histograma = dados->histogramas + (long)dados->id * RADIX_BALDES_THREAD;
+    long posicao[RADIX_BALDES_THREAD];
+
+    for(int deslocamento = 0; deslocamento < 32; deslocamento += RADIX_BITS_THREAD)
+    {
+        // Histograma local da faixa desta thread
+        memset(histograma, 0, RADIX_BALDES_THREAD * sizeof(long));
+        for(long i = dados->inicio; i < dados->fim; i++)
+        {
+            histograma[(((unsigned int)origem[i] ^ RADIX_SINAL_THREAD) >> deslocamento) & (RADIX_BALDES_THREAD - 1)]++;
+        }
+
+        pthread_barrier_wait(dados->barreira);
+
+        // Soma de prefixos global: posição inicial de cada dígito para esta thread
+        long soma = 0;
+        for(int d = 0; d < RADIX_BALDES_THREAD; d++)
+        {
+            for(int t = 0; t < dados->num_threads; t++)
+            {
+                if(t == dados->id)
+                {
+                    posicao[d] = soma;
+                }
+                soma += dados->histogramas[(long)t * RADIX_BALDES_THREAD + d];
+            }
+        }
+
+        // Distribuição estável da faixa desta thread no vetor de destino
+        for(long i = dados->inicio; i < dados->fim; i++)
+        {
+            int valor = origem[i];
+            destino[posicao[(((unsigned int)valor ^ RADIX_SINAL_THREAD) >> deslocamento) & (RADIX_BALDES_THREAD - 1)]++] = valor;
+        }
+
+        pthread_barrier_wait(dados->barreira);
+
+        int *temp = origem;
+        origem = destino;
+        destino = temp;
+    }
+
+    pthread_exit(0);
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL RADIX SORT COM THREADS
+// ============================================================
+/*
+    RadixSortThread: ordena um vetor de inteiros (incluindo negativos) usando Radix Sort LSD (base 256) com threads.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho_total: número de elementos no array
+        - num_threads: número de threads a serem utilizadas
+
+    Funcionamento:
+        - Aloca uma única vez o buffer auxiliar e a matriz de histogramas
+        - Divide o vetor em faixas contíguas, uma por thread
+        - Cria as threads, que executam juntas as 4 passadas sincronizadas por barreira
+          (fixadas nos núcleos com config_medicao.fixar_threads)
+        - Como o número de passadas é par, o resultado final termina no próprio vetor
+ */
+void RadixSortThread(int *vetor, long tamanho_total, int num_threads)
+{
+    if(tamanho_total <= 1)
+    {
+        return;
+    }
+
+    int threads_usadas = (int)min((long)num_threads, tamanho_total);
+
+    int *auxiliar = new int[tamanho_total];
+    long *histogramas = new long[(long)threads_usadas * RADIX_BALDES_THREAD];
+
+    pthread_barrier_t barreira;
+    pthread_barrier_init(&barreira, NULL, threads_usadas);
+
+    pthread_t *threads = new pthread_t[threads_usadas];
+    RadixThreadDados *dados = new RadixThreadDados[threads_usadas];
+
+    for(int t = 0; t < threads_usadas; t++)
+    {
+        dados[t].id = t;
+        dados[t].num_threads = threads_usadas;
+        dados[t].vetor = vetor;
+        dados[t].auxiliar = auxiliar;
+        dados[t].inicio = (tamanho_total * t) / threads_usadas;
+        dados[t].fim = (tamanho_total * (t + 1)) / threads_usadas;
+        dados[t].histogramas = histogramas;
+        dados[t].barreira = &barreira;
+
+        pthread_create(&threads[t], NULL, ThreadRadixWorker, &dados[t]);
+        FixarThread(threads[t], t);
+    }
+
+    for(int t = 0; t < threads_usadas; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    pthread_barrier_destroy(&barreira);
+    delete[] threads;
+    delete[] dados;
+    delete[] histogramas;
+    delete[] auxiliar;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecRadixThread: executa o Radix Sort com threads para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - num_threads: número de threads a serem utilizadas
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com RadixSortThread
+ */
+void ExecRadixThread(const char **entradas, int num_entradas, int num_threads, const char *csv_saida, const char *distribuicao)
+{
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/threads/radix_thread.csv", "RadixSort - Threads", num_threads,
+                              [](int *vetor, long tamanho, void *contexto) {
+                                  RadixSortThread(vetor, tamanho, *(int *)contexto);
+                              },
+                              &num_threads);
+}
@@ -0,0 +1,312 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o algoritmo Sample Sort de forma paralela na CPU usando threads POSIX.
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Ordenar os dados usando Sample Sort com threads
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com os dados ordenados
+        5. Registrar tempos em CSV
+
+    O Sample Sort escolhe p-1 divisores (splitters) a partir de uma amostra do vetor, o que
+    define p baldes (um por thread) com faixas de valores disjuntas e tamanhos parecidos.
+    Cada elemento é movido uma única vez para o seu balde, e cada thread ordena o seu balde
+    de forma independente com a ordenação sequencial. Ao contrário do Merge Sort com threads,
+    que faz log2(n) passadas pelo vetor, há uma única redistribuição dos dados.
+        - Amostragem: SAMPLE_SORT_SOBREAMOSTRAGEM elementos por balde, escolhidos ao acaso,
+          são ordenados e os divisores são tirados em intervalos regulares da amostra
+        - Classificação: cada thread conta quantos elementos da sua faixa vão para cada balde
+        - Distribuição: com a soma de prefixos das contagens (como no Radix Sort com threads),
+          cada thread copia os elementos da sua faixa para os baldes no vetor auxiliar
+        - Ordenação local: a thread t ordena o balde t com MergeSortSeqPingPongBuffer
+
+    Com muitas repetições (iguais, poucos_unicos, zipf), vários divisores podem ter o mesmo
+    valor. Os elementos iguais a um divisor repetido são espalhados por todos os baldes em que
+    cabem (BaldeDoValor), em vez de irem todos para o mesmo balde; e se a amostra mostra um
+    valor dominante, o vetor é ordenado com o Merge Sort com threads, que não depende dos valores.
+*/
+
+#pragma once
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <pthread.h>
+
+#include "pool_threads.h"
+#include "merge_sort_threads.h"
+#include "../sequencial/merge_sort_seq.h"
+
+#include "../../utils/arquivo_mapeado.h"
+
+using namespace std;
+
+#define SAMPLE_SORT_SOBREAMOSTRAGEM 64
+
+/*
+    SAMPLE_SORT_SOBREAMOSTRAGEM: número de elementos amostrados por balde.
+        - Amostras maiores deixam os baldes mais equilibrados, ao custo de ordenar a amostra.
+        - Vetores com menos de 4 vezes o tamanho da amostra são ordenados sequencialmente.
+        - Se um único valor ocupa mais da metade da amostra, o vetor é ordenado com
+          MergeSortThreadPool.
+*/
+
+// ============================================================
+//                  Estrutura de dados para threads
+// ============================================================
+/*
+    Estrutura SampleSortContexto: dados compartilhados pelas threads do pool durante uma ordenação.
+
+    Campos:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - auxiliar: buffer do mesmo tamanho do vetor, que recebe os baldes
+        - tamanho: número de elementos do vetor
+        - divisores: os num_baldes-1 divisores em ordem crescente
+        - num_baldes: número de baldes (igual ao número de threads do pool)
+        - histogramas: matriz [num_baldes (threads)][num_baldes] de contagens
+        - pool: pool de threads que executa a ordenação
+ */
+struct SampleSortContexto {
+    int *vetor;
+    int *auxiliar;
+    long tamanho;
+    int *divisores;
+    int num_baldes;
+    long *histogramas;
+    PoolThreads *pool;
+};
+
+/*
+    BaldeDoValor: índice do balde do elemento 'valor', que está na posição 'posicao' do vetor.
+
+    Funcionamento:
+        - O balde b recebe os valores em [divisores[b - 1], divisores[b]); um valor que não é
+          divisor vai para o balde do número de divisores menores ou iguais a ele
+        - Um valor igual aos divisores [primeiro, ultimo) cabe em qualquer balde de 'primeiro'
+          a 'ultimo' (nos do meio ele é o único valor, no primeiro fica no fim e no último no
+          início): a posição escolhe um deles, o que divide as repetições entre as threads.
+          A escolha depende só do valor e da posição, então é a mesma na contagem e na
+          distribuição
+ */
+static inline int BaldeDoValor(const int *divisores, int num_divisores, int valor, long posicao)
+{
+    int ultimo = (int)(upper_bound(divisores, divisores + num_divisores, valor) - divisores);
+    if(ultimo == 0 || divisores[ultimo - 1] != valor)
+    {
+        return ultimo;
+    }
+
+    int primeiro = (int)(lower_bound(divisores, divisores + ultimo, valor) - divisores);
+    return primeiro + (int)(posicao % (ultimo - primeiro + 1));
+}
+
+// ============================================================
+//                  FUNÇÃO DE TRABALHO DAS THREADS
+// ============================================================
+/*
+    TarefaSampleSort: tarefa executada por cada thread do pool.
+
+    Parâmetros:
+        - arg: ponteiro para o SampleSortContexto da ordenação
+        - id: índice da thread no pool (e do balde que ela ordena)
+
+    Funcionamento:
+        - Conta, no seu histograma, o balde de cada elemento da sua faixa
+        - Espera todas as threads (SincronizarPool)
+        - Calcula a posição inicial de cada balde para a sua faixa e distribui os elementos
+          no vetor auxiliar, além do início e fim do balde 'id'
+        - Espera todas as threads e ordena o balde 'id', usando o mesmo intervalo do vetor
+          original como buffer; o resultado termina no vetor original
+ */
+void TarefaSampleSort(void *arg, int id)
+{
+    SampleSortContexto *contexto = (SampleSortContexto *)arg;
+    int num_baldes = contexto->num_baldes;
+    int num_divisores = num_baldes - 1;
+    long *histograma = contexto->histogramas + (long)id * num_baldes;
+
+    long inicio = (contexto->tamanho * id) / num_baldes;
+    long fim = (contexto->tamanho * (id + 1)) / num_baldes;
+
+    // Classificação: contagem de elementos por balde na faixa desta thread
+    memset(histograma, 0, num_baldes * sizeof(long));
+    for(long i = inicio; i < fim; i++)
+    {
+        histograma[BaldeDoValor(contexto->divisores, num_divisores, contexto->vetor[i], i)]++;
+    }
+
+    SincronizarPool(contexto->pool);
+
+    // Soma de prefixos global: posição de cada balde para esta thread e limites do balde 'id'
+    long *posicao = new long[num_baldes];
+    long soma = 0;
+    long inicio_balde = 0, fim_balde = 0;
+    for(int b = 0; b < num_baldes; b++)
+    {
+        if(b == id)
+        {
+            inicio_balde = soma;
+        }
+        for(int t = 0; t < num_baldes; t++)
+        {
+            if(t == id)
+            {
+                posicao[b] = soma;
+            }
+            soma += contexto->histogramas[(long)t * num_baldes + b];
+        }
+        if(b == id)
+        {
+            fim_balde = soma;
+        }
+    }
+
+    // Distribuição dos elementos da faixa nos baldes
+    for(long i = inicio; i < fim; i++)
+    {
+        int valor = contexto->vetor[i];
+        contexto->auxiliar[posicao[BaldeDoValor(contexto->divisores, num_divisores, valor, i)]++] = valor;
+    }
+    delete[] posicao;
+
+    SincronizarPool(contexto->pool);
+
+    // Ordenação local do balde desta thread
+    long tamanho_balde = fim_balde - inicio_balde;
+    if(tamanho_balde > 0)
+    {
+        int *balde = contexto->auxiliar + inicio_balde;
+        int *destino = contexto->vetor + inicio_balde;
+        int *resultado = MergeSortSeqPingPongBuffer(balde, destino, tamanho_balde);
+        if(resultado != destino)
+        {
+            memcpy(destino, resultado, tamanho_balde * sizeof(int));
+        }
+    }
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL SAMPLE SORT COM THREADS
+// ============================================================
+/*
+    SampleSortThreadPool: ordena um vetor de inteiros usando Sample Sort com as threads de um pool.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros a ser ordenado
+        - tamanho: número de elementos no array
+        - pool: pool de threads (CriarPool) que executará a ordenação
+
+    Funcionamento:
+        - Vetores pequenos em relação à amostra são ordenados com MergeSortSeqPingPong
+        - Sorteia a amostra (semente fixa, para resultados reprodutíveis) e a ordena; se um
+          valor ocupa mais da metade dela, usa MergeSortThreadPool
+        - Escolhe os divisores em intervalos de SAMPLE_SORT_SOBREAMOSTRAGEM elementos
+        - Executa TarefaSampleSort em todas as threads do pool
+ */
+void SampleSortThreadPool(int *vetor, long tamanho, PoolThreads *pool)
+{
+    int num_baldes = pool->num_threads;
+    long tamanho_amostra = (long)num_baldes * SAMPLE_SORT_SOBREAMOSTRAGEM;
+
+    if(num_baldes == 1 || tamanho < 4 * tamanho_amostra)
+    {
+        MergeSortSeqPingPong(vetor, tamanho);
+        return;
+    }
+
+    // Amostragem e escolha dos divisores
+    int *amostra = new int[tamanho_amostra];
+    mt19937_64 gerador(tamanho);
+    for(long i = 0; i < tamanho_amostra; i++)
+    {
+        amostra[i] = vetor[gerador() % tamanho];
+    }
+    MergeSortSeqPingPong(amostra, tamanho_amostra);
+
+    // Maior sequência de valores iguais na amostra ordenada
+    long maior_repeticao = 1, repeticao = 1;
+    for(long i = 1; i < tamanho_amostra; i++)
+    {
+        repeticao = amostra[i] == amostra[i - 1] ? repeticao + 1 : 1;
+        maior_repeticao = max(maior_repeticao, repeticao);
+    }
+    if(2 * maior_repeticao > tamanho_amostra)
+    {
+        delete[] amostra;
+        MergeSortThreadPool(vetor, tamanho, pool);
+        return;
+    }
+
+    int *divisores = new int[num_baldes - 1];
+    for(int b = 1; b < num_baldes; b++)
+    {
+        divisores[b - 1] = amostra[(long)b * SAMPLE_SORT_SOBREAMOSTRAGEM];
+    }
+    delete[] amostra;
+
+    SampleSortContexto contexto;
+    contexto.vetor = vetor;
+    contexto.auxiliar = new int[tamanho];
+    contexto.tamanho = tamanho;
+    contexto.divisores = divisores;
+    contexto.num_baldes = num_baldes;
+    contexto.histogramas = new long[(long)num_baldes * num_baldes];
+    contexto.pool = pool;
+
+    ExecutarPool(pool, TarefaSampleSort, &contexto);
+
+    delete[] contexto.histogramas;
+    delete[] contexto.auxiliar;
+    delete[] divisores;
+}
+
+/*
+    SampleSortThread: igual ao SampleSortThreadPool, criando um pool temporário com num_threads threads.
+ */
+void SampleSortThread(int *vetor, long tamanho, int num_threads)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+    SampleSortThreadPool(vetor, tamanho, &pool);
+    DestruirPool(&pool);
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecSampleSortThread: executa o Sample Sort com threads para múltiplos arquivos binários
+    contendo inteiros, mede o tempo de ordenação e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - num_threads: número de threads a serem utilizadas
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Cria o pool de threads uma única vez, fora da região medida
+        - Usa ExecOrdenacaoMapeada, ordenando cada arquivo mapeado com SampleSortThreadPool
+ */
+void ExecSampleSortThread(const char **entradas, int num_entradas, int num_threads, const char *csv_saida, const char *distribuicao)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/threads/sample_thread.csv", "SampleSort - Threads", num_threads,
+                              [](int *vetor, long tamanho, void *contexto) {
+                                  SampleSortThreadPool(vetor, tamanho, (PoolThreads *)contexto);
+                              },
+                              &pool);
+
+    DestruirPool(&pool);
+}
@@ -0,0 +1,265 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o radix select (nth_element) de forma paralela na CPU, usando o
+    pool de threads POSIX.
+    O fluxo geral é:
+        1. Ler vetores de arquivos binários (int)
+        2. Encontrar o k-ésimo menor elemento e particionar o vetor em torno dele, com threads
+        3. Medir o tempo de execução
+        4. Regravar o arquivo com o resultado
+        5. Registrar tempos em CSV
+
+    O valor procurado é encontrado sem mover nenhum elemento:
+        - Em cada nível (dígitos de RADIX_MSD_BITS bits, do mais significativo para o menos
+          significativo), cada thread conta, na sua faixa, os dígitos dos elementos cujos
+          dígitos anteriores são os do prefixo já encontrado
+        - Todas as threads somam os histogramas e escolhem o mesmo dígito (o do balde que
+          contém a posição procurada), estendendo o prefixo; após o último nível o prefixo é
+          o próprio valor
+        - Ao longo dos níveis, cada thread acumula quantos elementos da sua faixa são menores
+          que o valor (os dos baldes anteriores ao escolhido) e, no último nível, quantos são
+          iguais
+    Com essas contagens, como no Radix Sort com threads, cada thread copia os elementos da sua
+    faixa para as três partes (menores, iguais e maiores) em um vetor auxiliar, e depois copia
+    a sua faixa do auxiliar de volta.
+
+    São 4 leituras do vetor sem escrita, paralelas e sem sincronização além das barreiras,
+    mais uma distribuição e uma cópia; o quickselect sequencial, ao contrário, move os
+    elementos a cada partição.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pool_threads.h"
+#include "../sequencial/selecao_seq.h"
+
+#include "../../utils/arquivo_mapeado.h"
+
+#define SELECAO_MINIMO_THREADS 65536
+
+/*
+    SELECAO_MINIMO_THREADS: vetores menores usam o RadixSelectSeq.
+*/
+
+// ============================================================
+//                  Estrutura de dados para threads
+// ============================================================
+/*
+    Estrutura RadixSelectContexto: dados compartilhados pelas threads do pool durante uma seleção.
+
+    Campos:
+        - vetor: ponteiro para o array de inteiros
+        - auxiliar: buffer do mesmo tamanho do vetor, que recebe as três partes
+        - tamanho: número de elementos do vetor
+        - posicao: posição procurada
+        - num_threads: número de threads do pool
+        - histogramas: matriz [num_threads][RADIX_MSD_BALDES] de contagens do nível atual
+        - menores, iguais: elementos menores e iguais ao valor procurado na faixa de cada thread
+        - pool: pool de threads que executa a seleção
+ */
+struct RadixSelectContexto {
+    int *vetor;
+    int *auxiliar;
+    long tamanho;
+    long posicao;
+    int num_threads;
+    long *histogramas;
+    long *menores;
+    long *iguais;
+    PoolThreads *pool;
+};
+
+// ============================================================
+//                  FUNÇÃO DE TRABALHO DAS THREADS
+// ============================================================
+/*
+    TarefaRadixSelect: tarefa executada por cada thread do pool.
+
+    Parâmetros:
+        - arg: ponteiro para o RadixSelectContexto da seleção
+        - id: índice da thread no pool
+
+    Funcionamento:
+        - Para cada nível: histograma dos elementos da faixa com o prefixo atual, barreira,
+          soma dos histogramas e escolha do dígito (a mesma em todas as threads, sem outra
+          barreira para publicá-la), barreira antes de o histograma ser reutilizado
+        - Publica as contagens da faixa, espera as demais threads e calcula onde começam os
+          menores, iguais e maiores da sua faixa no auxiliar
+        - Distribui a faixa no auxiliar, espera as demais threads e copia a sua faixa de volta
+ */
+void TarefaRadixSelect(void *arg, int id)
+{
+    RadixSelectContexto *contexto = (RadixSelectContexto *)arg;
+    const int *vetor = contexto->vetor;
+    long *histograma = contexto->histogramas + (long)id * RADIX_MSD_BALDES;
+
+    long inicio = (contexto->tamanho * id) / contexto->num_threads;
+    long fim = (contexto->tamanho * (id + 1)) / contexto->num_threads;
+
+    uint32_t prefixo = 0, mascara = 0;  // dígitos já escolhidos, com o bit de sinal invertido
+    long restante = contexto->posicao;  // posição entre os elementos com o prefixo
+    long menores = 0, iguais = 0;
+
+    for (int deslocamento = 32 - RADIX_MSD_BITS; deslocamento >= 0; deslocamento -= RADIX_MSD_BITS)
+    {
+        memset(histograma, 0, RADIX_MSD_BALDES * sizeof(long));
+        for (long i = inicio; i < fim; i++)
+        {
+            uint32_t chave = (uint32_t)vetor[i] ^ RADIX_MSD_SINAL;
+            if ((chave & mascara) == prefixo)
+            {
+                histograma[(chave >> deslocamento) & (RADIX_MSD_BALDES - 1)]++;
+            }
+        }
+
+        SincronizarPool(contexto->pool);
+
+        int alvo = 0;
+        for (; alvo < RADIX_MSD_BALDES; alvo++)
+        {
+            long total = 0;
+            for (int t = 0; t < contexto->num_threads; t++)
+            {
+                total += contexto->histogramas[(long)t * RADIX_MSD_BALDES + alvo];
+            }
+            if (restante < total)
+                break;
+
+            restante -= total;
+            menores += histograma[alvo];
+        }
+        iguais = histograma[alvo];
+
+        prefixo |= (uint32_t)alvo << deslocamento;
+        mascara |= (uint32_t)(RADIX_MSD_BALDES - 1) << deslocamento;
+
+        SincronizarPool(contexto->pool);
+    }
+
+    int valor = (int)(prefixo ^ RADIX_MSD_SINAL);
+    contexto->menores[id] = menores;
+    contexto->iguais[id] = iguais;
+
+    SincronizarPool(contexto->pool);
+
+    // Início das três partes desta faixa no auxiliar
+    long total_menores = 0, total_iguais = 0;
+    long pos_menor = 0, pos_igual = 0, pos_maior = 0;
+    for (int t = 0; t < contexto->num_threads; t++)
+    {
+        long inicio_t = (contexto->tamanho * t) / contexto->num_threads;
+        long fim_t = (contexto->tamanho * (t + 1)) / contexto->num_threads;
+        if (t < id)
+        {
+            pos_menor += contexto->menores[t];
+            pos_igual += contexto->iguais[t];
+            pos_maior += (fim_t - inicio_t) - contexto->menores[t] - contexto->iguais[t];
+        }
+        total_menores += contexto->menores[t];
+        total_iguais += contexto->iguais[t];
+    }
+    pos_igual += total_menores;
+    pos_maior += total_menores + total_iguais;
+
+    int *auxiliar = contexto->auxiliar;
+    for (long i = inicio; i < fim; i++)
+    {
+        int elemento = vetor[i];
+        if (elemento < valor)
+            auxiliar[pos_menor++] = elemento;
+        else if (elemento == valor)
+            auxiliar[pos_igual++] = elemento;
+        else
+            auxiliar[pos_maior++] = elemento;
+    }
+
+    SincronizarPool(contexto->pool);
+
+    memcpy(contexto->vetor + inicio, auxiliar + inicio, (fim - inicio) * sizeof(int));
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL RADIX SELECT COM THREADS
+// ============================================================
+/*
+    RadixSelectThreadPool: coloca em vetor[posicao] o elemento que estaria nessa posição no
+    vetor ordenado, com os menores antes e os maiores depois, usando as threads de um pool.
+
+    Parâmetros:
+        - vetor: ponteiro para o array de inteiros (incluindo negativos)
+        - tamanho: número de elementos no array
+        - posicao: posição procurada (0 a tamanho - 1)
+        - pool: pool de threads (CriarPool) que executará a seleção
+
+    Funcionamento:
+        - Vetores com menos de SELECAO_MINIMO_THREADS elementos usam o RadixSelectSeq
+        - Senão, executa TarefaRadixSelect em todas as threads do pool
+ */
+void RadixSelectThreadPool(int *vetor, long tamanho, long posicao, PoolThreads *pool)
+{
+    if (tamanho < SELECAO_MINIMO_THREADS || pool->num_threads == 1)
+    {
+        RadixSelectSeq(vetor, tamanho, posicao);
+        return;
+    }
+
+    int num_threads = pool->num_threads;
+
+    RadixSelectContexto contexto;
+    contexto.vetor = vetor;
+    contexto.auxiliar = new int[tamanho];
+    contexto.tamanho = tamanho;
+    contexto.posicao = posicao;
+    contexto.num_threads = num_threads;
+    contexto.histogramas = new long[(long)num_threads * RADIX_MSD_BALDES];
+    contexto.menores = new long[num_threads];
+    contexto.iguais = new long[num_threads];
+    contexto.pool = pool;
+
+    ExecutarPool(pool, TarefaRadixSelect, &contexto);
+
+    delete[] contexto.iguais;
+    delete[] contexto.menores;
+    delete[] contexto.histogramas;
+    delete[] contexto.auxiliar;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecRadixSelectThread: executa o radix select com threads para múltiplos arquivos binários
+    contendo inteiros, mede o tempo e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - num_threads: número de threads a serem utilizadas
+        - csv_saida: caminho do arquivo CSV de saída onde serão registrados os tempos
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+
+    Funcionamento:
+        - Cria o pool de threads uma única vez, fora da região medida
+        - Usa ExecOrdenacaoMapeada com a posição ElementosSelecionados(n) - 1
+ */
+void ExecRadixSelectThread(const char **entradas, int num_entradas, int num_threads, const char *csv_saida, const char *distribuicao)
+{
+    PoolThreads pool;
+    CriarPool(&pool, num_threads);
+
+    ExecOrdenacaoMapeada<int>(entradas, num_entradas, csv_saida, distribuicao,
+                              "results/threads/nth_radix_thread.csv", "Seleção - Radix Select - Threads (nth_element)", num_threads,
+                              [](int *vetor, long tamanho, void *contexto) {
+                                  RadixSelectThreadPool(vetor, tamanho, ElementosSelecionados(tamanho) - 1,
+                                                        (PoolThreads *)contexto);
+                              },
+                              &pool);
+
+    DestruirPool(&pool);
+}
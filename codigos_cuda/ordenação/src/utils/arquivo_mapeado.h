@@ -0,0 +1,464 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o acesso aos arquivos binários de entrada por mapeamento em
+    memória (mmap), usado pelas funções Exec* para ordenar os arquivos no próprio lugar.
+    O fluxo geral é:
+        1. MapearArquivo abre o arquivo e o mapeia com MAP_SHARED: o vetor ordenado é a
+           própria cache de páginas do arquivo, sem uma segunda cópia em um new int[]
+        2. A ordenação escreve diretamente nas páginas mapeadas
+        3. DesmapearArquivo desfaz o mapeamento; o kernel grava as páginas alteradas no
+           arquivo, sem fseek/fwrite
+        4. ExecOrdenacaoMapeada repete os passos para cada arquivo, medindo separadamente o
+           tempo de E/S (mapeamento e desmapeamento) e o tempo de ordenação, e registra os
+           dois no CSV; as funções Exec* de cada algoritmo apenas a chamam
+
+    Com fread/fwrite, cada arquivo ocupava a memória duas vezes (cache de páginas e vetor
+    alocado) e era copiado inteiro na leitura e na escrita.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+
+#include "medicao.h"
+#include "pipeline_es.h"
+
+/*
+    Os tamanhos e índices dos vetores usam long em todas as ordenações (e em FuncaoOrdenacao),
+    o que exige um sistema de 64 bits (LP64) para vetores com mais de 2^31 elementos.
+*/
+static_assert(sizeof(long) >= 8, "as ordenações exigem long de 64 bits (LP64)");
+
+// ============================================================
+//                  Estrutura do arquivo mapeado
+// ============================================================
+/*
+    Estrutura ArquivoMapeado: um arquivo aberto e mapeado em memória.
+
+    Campos:
+        - fd: descritor do arquivo
+        - dados: início do mapeamento (NULL se o arquivo estiver vazio)
+        - bytes: tamanho do arquivo em bytes
+ */
+struct ArquivoMapeado {
+    int fd;
+    void *dados;
+    size_t bytes;
+};
+
+// ============================================================
+//             FUNÇÕES DE MAPEAMENTO DOS ARQUIVOS
+// ============================================================
+/*
+    MapearArquivo: abre 'caminho' para leitura e escrita e o mapeia inteiro em memória.
+
+    Parâmetros:
+        - caminho: caminho do arquivo binário
+        - arquivo: estrutura preenchida com o descritor, o mapeamento e o tamanho
+
+    Retorno:
+        - true em caso de sucesso; em caso de erro imprime a mensagem (perror) e retorna false
+
+    Funcionamento:
+        - MAP_SHARED faz com que as escritas no mapeamento alterem o próprio arquivo
+        - MAP_POPULATE e MADV_WILLNEED leem o arquivo de uma vez, em sequência, antes da
+          ordenação, para que a leitura do disco não seja medida junto com o tempo de ordenação
+        - As páginas são mapeadas apenas para leitura: a primeira escrita em cada uma ainda
+          causa uma falha de página (PrepararEscritaMapeada)
+ */
+bool MapearArquivo(const char *caminho, ArquivoMapeado *arquivo)
+{
+    arquivo->fd = open(caminho, O_RDWR);
+    arquivo->dados = NULL;
+    arquivo->bytes = 0;
+
+    if (arquivo->fd < 0)
+    {
+        perror(caminho);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(arquivo->fd, &info) != 0)
+    {
+        perror(caminho);
+        close(arquivo->fd);
+        return false;
+    }
+
+    arquivo->bytes = (size_t)info.st_size;
+    if (arquivo->bytes == 0)
+    {
+        return true; // arquivo vazio: nada a mapear
+    }
+
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+
+    void *dados = mmap(NULL, arquivo->bytes, PROT_READ | PROT_WRITE, flags, arquivo->fd, 0);
+    if (dados == MAP_FAILED)
+    {
+        perror("Erro ao mapear o arquivo");
+        close(arquivo->fd);
+        return false;
+    }
+
+    madvise(dados, arquivo->bytes, MADV_WILLNEED);
+
+    arquivo->dados = dados;
+    return true;
+}
+
+/*
+    CriarArquivoMapeado: cria (ou trunca) 'caminho' com 'bytes' bytes e o mapeia para escrita.
+
+    Parâmetros:
+        - caminho: caminho do arquivo binário
+        - bytes: tamanho do arquivo
+        - arquivo: estrutura preenchida com o descritor, o mapeamento e o tamanho
+
+    Retorno:
+        - true em caso de sucesso; em caso de erro imprime a mensagem (perror) e retorna false
+
+    Funcionamento:
+        - ftruncate define o tamanho; as páginas são criadas à medida que são escritas,
+          sem MAP_POPULATE, já que não há conteúdo anterior a ler
+ */
+bool CriarArquivoMapeado(const char *caminho, size_t bytes, ArquivoMapeado *arquivo)
+{
+    arquivo->fd = open(caminho, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    arquivo->dados = NULL;
+    arquivo->bytes = bytes;
+
+    if (arquivo->fd < 0)
+    {
+        perror(caminho);
+        return false;
+    }
+
+    if (ftruncate(arquivo->fd, (off_t)bytes) != 0)
+    {
+        perror(caminho);
+        close(arquivo->fd);
+        return false;
+    }
+
+    if (bytes == 0)
+    {
+        return true;
+    }
+
+    void *dados = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, arquivo->fd, 0);
+    if (dados == MAP_FAILED)
+    {
+        perror("Erro ao mapear o arquivo");
+        close(arquivo->fd);
+        return false;
+    }
+
+    arquivo->dados = dados;
+    return true;
+}
+
+/*
+    PrepararEscritaMapeada: causa, antes da ordenação, as falhas de página da primeira escrita
+    em cada página de um arquivo mapeado com MapearArquivo.
+
+    Parâmetros:
+        - arquivo: arquivo mapeado
+
+    Funcionamento:
+        - Em um mapeamento MAP_SHARED, MAP_POPULATE só mapeia as páginas para leitura; a
+          primeira escrita em cada página passa pelo sistema de arquivos, que a marca como
+          suja e, em uma entrada restaurada por reflink, copia o bloco compartilhado (cópia
+          sob escrita). Sem esta função, esse custo seria medido no tempo de ordenação
+        - MADV_POPULATE_WRITE (Linux 5.14) faz essas falhas de uma vez; em kernels antigos,
+          cada página é reescrita com o próprio conteúdo
+ */
+void PrepararEscritaMapeada(ArquivoMapeado *arquivo)
+{
+    if (!arquivo->dados)
+    {
+        return;
+    }
+
+#ifdef MADV_POPULATE_WRITE
+    if (madvise(arquivo->dados, arquivo->bytes, MADV_POPULATE_WRITE) == 0)
+    {
+        return;
+    }
+#endif
+
+    long pagina = sysconf(_SC_PAGESIZE);
+    volatile char *dados = (volatile char *)arquivo->dados;
+    for (size_t i = 0; i < arquivo->bytes; i += (size_t)pagina)
+    {
+        dados[i] = dados[i];
+    }
+}
+
+/*
+    DesmapearArquivo: desfaz o mapeamento e fecha o arquivo.
+
+    Parâmetros:
+        - arquivo: arquivo mapeado com MapearArquivo ou CriarArquivoMapeado
+
+    Funcionamento:
+        - As páginas alteradas continuam na cache de páginas e são gravadas pelo kernel;
+          assim como com fwrite, não há espera pela escrita no disco
+ */
+void DesmapearArquivo(ArquivoMapeado *arquivo)
+{
+    if (arquivo->dados)
+    {
+        munmap(arquivo->dados, arquivo->bytes);
+        arquivo->dados = NULL;
+    }
+
+    close(arquivo->fd);
+}
+
+/*
+    CopiarArquivo: copia 'origem' para 'destino' (criado ou sobrescrito), sem passar os dados
+    pelo espaço de usuário sempre que possível.
+
+    Parâmetros:
+        - origem: arquivo a ser copiado
+        - destino: arquivo de destino
+
+    Retorno:
+        - true em caso de sucesso; em caso de erro imprime a mensagem (perror) e retorna false
+
+    Funcionamento:
+        - Tenta um reflink (ioctl FICLONE): em sistemas de arquivos com cópia sob escrita
+          (btrfs, XFS) o destino compartilha os blocos da origem e a cópia é instantânea
+        - Senão, copia com copy_file_range, feito dentro do kernel
+        - Se o kernel não suportar copy_file_range entre os dois arquivos, termina a cópia
+          com pwrite a partir da origem mapeada em memória
+ */
+bool CopiarArquivo(const char *origem, const char *destino)
+{
+    int fd_origem = open(origem, O_RDONLY);
+    if (fd_origem < 0)
+    {
+        perror(origem);
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd_origem, &info) != 0)
+    {
+        perror(origem);
+        close(fd_origem);
+        return false;
+    }
+    size_t bytes = (size_t)info.st_size;
+
+    int fd_destino = open(destino, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd_destino < 0)
+    {
+        perror(destino);
+        close(fd_origem);
+        return false;
+    }
+
+#ifdef FICLONE
+    if (ioctl(fd_destino, FICLONE, fd_origem) == 0)
+    {
+        close(fd_origem);
+        close(fd_destino);
+        return true;
+    }
+#endif
+
+    size_t copiados = 0;
+    while (copiados < bytes)
+    {
+        ssize_t n = copy_file_range(fd_origem, NULL, fd_destino, NULL, bytes - copiados, 0);
+        if (n <= 0)
+        {
+            break;
+        }
+        copiados += (size_t)n;
+    }
+
+    bool ok = true;
+    if (copiados < bytes)
+    {
+        void *dados = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd_origem, 0);
+        if (dados == MAP_FAILED)
+        {
+            perror("Erro ao mapear o arquivo");
+            ok = false;
+        }
+        else
+        {
+            madvise(dados, bytes, MADV_SEQUENTIAL);
+            while (copiados < bytes)
+            {
+                ssize_t n = pwrite(fd_destino, (char *)dados + copiados, bytes - copiados, (off_t)copiados);
+                if (n <= 0)
+                {
+                    perror(destino);
+                    ok = false;
+                    break;
+                }
+                copiados += (size_t)n;
+            }
+            munmap(dados, bytes);
+        }
+    }
+
+    close(fd_origem);
+    close(fd_destino);
+    return ok;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    FuncaoOrdenacao: assinatura das funções de ordenação usadas por ExecOrdenacaoMapeada.
+        - vetor: dados mapeados do arquivo, ordenados no próprio lugar
+        - tamanho: número de elementos
+        - contexto: ponteiro repassado sem alteração (por exemplo, um pool de threads)
+ */
+template <typename T>
+using FuncaoOrdenacao = void (*)(T *vetor, long tamanho, void *contexto);
+
+/*
+    ExecOrdenacaoMapeada: ordena no próprio lugar múltiplos arquivos binários com elementos do
+    tipo T, mede os tempos e registra os resultados em CSV.
+
+    Parâmetros:
+        - entradas: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - csv_saida: CSV geral (CABECALHO_CSV_GERAL)
+        - distribuicao: distribuição das entradas, na coluna Distribuicao dos CSVs
+        - csv_algoritmo: CSV do algoritmo (Distribuicao,Threads + CABECALHO_ESTATISTICAS), que
+          recebe o cabeçalho
+        - nome: nome do algoritmo, usado na coluna Algoritmo e na mensagem impressa
+        - num_threads: número de threads do algoritmo (1 nos sequenciais), coluna Threads
+        - ordenar: função de ordenação
+        - contexto: ponteiro repassado a 'ordenar'
+
+    Funcionamento:
+        * Para cada arquivo, ExecucoesPorArquivo() vezes (config_medicao):
+        - Restaura a entrada (a partir da segunda execução), mapeia o arquivo (MapearArquivo),
+          faz as falhas de página da primeira escrita (PrepararEscritaMapeada) e ordena os
+          dados mapeados com 'ordenar'
+        - Desmapeia o arquivo, o que mantém os dados ordenados no arquivo
+        - TempoES soma o mapeamento (leitura e falhas de escrita) e o desmapeamento; Tempo é
+          só a ordenação
+        - Os contadores de desempenho (contadores.h), se abertos, medem apenas a ordenação
+        - Com config_medicao.fixar_threads, a thread principal fica no núcleo 0 apenas durante
+          a ordenação (FixarThread / LiberarThread)
+        * Descarta as execuções de aquecimento e registra as estatísticas das repetições
+        - Com config_medicao.buffers_pipeline > 0, delega ao ExecOrdenacaoPipeline
+          (pipeline_es.h), que lê e grava os arquivos em buffers, sobrepondo a E/S à ordenação
+ */
+template <typename T>
+void ExecOrdenacaoMapeada(const char **entradas, int num_entradas, const char *csv_saida,
+                          const char *distribuicao, const char *csv_algoritmo, const char *nome,
+                          int num_threads, FuncaoOrdenacao<T> ordenar, void *contexto)
+{
+    if (config_medicao.buffers_pipeline > 0)
+    {
+        ExecOrdenacaoPipeline<T>(entradas, num_entradas, csv_saida, distribuicao, csv_algoritmo, nome,
+                                 num_threads, ordenar, contexto);
+        return;
+    }
+
+    FILE *csv = fopen(csv_saida, "a");
+    FILE *algoritmo_csv = fopen(csv_algoritmo, "a");
+    if (!csv || !algoritmo_csv)
+    {
+        perror("Erro ao abrir arquivos de saída CSV");
+        if (csv)
+            fclose(csv);
+        if (algoritmo_csv)
+            fclose(algoritmo_csv);
+        return;
+    }
+
+    fprintf(algoritmo_csv, "Distribuicao,Threads," CABECALHO_ESTATISTICAS "\n");
+
+    int execucoes = ExecucoesPorArquivo();
+    double *tempos = new double[execucoes];
+    double *tempos_es = new double[execucoes];
+    LeituraContadores *leituras = new LeituraContadores[execucoes];
+
+    for (int i = 0; i < num_entradas; i++)
+    {
+        long tamanho = 0;
+        int medidas = 0;
+
+        for (int execucao = 0; execucao < execucoes; execucao++)
+        {
+            if (execucao > 0 && !config_medicao.restaurar(entradas[i]))
+            {
+                break;
+            }
+
+            auto inicio_leitura = std::chrono::high_resolution_clock::now();
+            ArquivoMapeado arquivo;
+            if (!MapearArquivo(entradas[i], &arquivo))
+            {
+                break;
+            }
+            PrepararEscritaMapeada(&arquivo);
+            tamanho = (long)(arquivo.bytes / sizeof(T));
+
+            LeituraContadores leitura;
+            FixarThread(pthread_self(), 0);
+            IniciarContadores();
+            auto inicio = std::chrono::high_resolution_clock::now();
+            if (tamanho > 0)
+            {
+                ordenar((T *)arquivo.dados, tamanho, contexto);
+            }
+            auto fim = std::chrono::high_resolution_clock::now();
+            PararContadores(&leitura);
+            LiberarThread(pthread_self());
+
+            DesmapearArquivo(&arquivo);
+            auto fim_escrita = std::chrono::high_resolution_clock::now();
+
+            if (ExecucaoRegistrada(execucao))
+            {
+                std::chrono::duration<double> ordenacao = fim - inicio;
+                std::chrono::duration<double> entrada_saida = (inicio - inicio_leitura) + (fim_escrita - fim);
+                tempos[medidas] = ordenacao.count();
+                tempos_es[medidas] = entrada_saida.count();
+                leituras[medidas] = leitura;
+                medidas++;
+            }
+        }
+
+        if (medidas == 0)
+        {
+            continue;
+        }
+
+        RegistrarMedicoes(csv, algoritmo_csv, nome, entradas[i], distribuicao, num_threads,
+                          tamanho, tempos, tempos_es, leituras, medidas);
+    }
+
+    delete[] tempos;
+    delete[] tempos_es;
+    delete[] leituras;
+    fclose(csv);
+    fclose(algoritmo_csv);
+}
@@ -0,0 +1,336 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa os contadores de desempenho do processador (perf_event_open),
+    lidos pelos Exec* em volta de cada região medida.
+    O fluxo geral é:
+        1. O main chama AbrirContadores (opção --contadores) antes de criar qualquer thread
+        2. Os Exec* chamam IniciarContadores antes da ordenação e PararContadores depois,
+           guardando uma LeituraContadores por repetição
+        3. MedianaContadores resume as repetições; EscreverEstatisticas (medicao.h) grava as
+           colunas de CABECALHO_CONTADORES e ImprimirContadores imprime o IPC e as falhas por
+           elemento
+
+    O tempo não explica sozinho a diferença entre dois algoritmos: o IPC (instruções por
+    ciclo) e as falhas de desvio, de cache (LLC) e de TLB por elemento mostram se um algoritmo
+    é limitado pela memória, por desvios mal previstos ou pelo número de instruções.
+
+    Os contadores são opcionais: sem --contadores, ou se o kernel não os oferecer (máquina
+    virtual, contêiner, /proc/sys/kernel/perf_event_paranoid restritivo), as colunas ficam vazias.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#define CABECALHO_CONTADORES "Ciclos,Instrucoes,FalhasDesvio,FalhasLLC,FalhasDTLB"
+
+/*
+    CABECALHO_CONTADORES: colunas dos contadores, na ordem de Contador.
+*/
+
+// ============================================================
+//                  EVENTOS MEDIDOS
+// ============================================================
+/*
+    Enum Contador: contadores lidos em cada região medida.
+ */
+enum Contador {
+    CICLOS,
+    INSTRUCOES,
+    FALHAS_DESVIO,
+    FALHAS_LLC,
+    FALHAS_DTLB,
+    NUM_CONTADORES
+};
+
+/*
+    Estrutura EventoContador: evento do perf_event_open associado a um Contador.
+
+    Campos:
+        - nome: nome usado nos avisos
+        - tipo, config: campos type e config de perf_event_attr
+ */
+struct EventoContador {
+    const char *nome;
+    uint32_t tipo;
+    uint64_t config;
+};
+
+#define EVENTO_CACHE(cache, operacao, resultado) \
+    ((cache) | ((operacao) << 8) | ((resultado) << 16))
+
+static EventoContador eventos_contadores[NUM_CONTADORES] = {
+    {"ciclos", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instruções", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"falhas de desvio", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"falhas de LLC", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"falhas de dTLB", PERF_TYPE_HW_CACHE,
+     EVENTO_CACHE(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+};
+
+/*
+    descritores_contadores: descritor de cada contador aberto, ou -1.
+ */
+static int descritores_contadores[NUM_CONTADORES] = {-1, -1, -1, -1, -1};
+
+// ============================================================
+//                  ABERTURA DOS CONTADORES
+// ============================================================
+/*
+    AbrirContadores: abre os contadores de eventos_contadores para o processo.
+
+    Retorno:
+        - número de contadores abertos; os que o kernel recusar ficam desativados (aviso em stderr)
+
+    Funcionamento:
+        - Cada contador é aberto separadamente (sem grupo), desativado e com inherit: as
+          threads criadas depois da abertura (pools, threads do radix, ...) herdam os
+          contadores, e a leitura do descritor soma as contagens delas. Por isso deve ser
+          chamada antes da criação de qualquer thread
+        - exclude_kernel conta apenas o modo usuário, permitido com perf_event_paranoid <= 2;
+          as falhas de página do mapeamento ficam de fora
+        - Mais eventos do que contadores físicos são multiplexados pelo kernel; PararContadores
+          corrige a contagem pela fração do tempo em que cada um esteve ativo
+ */
+int AbrirContadores()
+{
+    int abertos = 0;
+
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        if (descritores_contadores[c] >= 0)
+        {
+            abertos++;
+            continue;
+        }
+
+        struct perf_event_attr atributos;
+        memset(&atributos, 0, sizeof(atributos));
+        atributos.size = sizeof(atributos);
+        atributos.type = eventos_contadores[c].tipo;
+        atributos.config = eventos_contadores[c].config;
+        atributos.disabled = 1;
+        atributos.inherit = 1;
+        atributos.exclude_kernel = 1;
+        atributos.exclude_hv = 1;
+        atributos.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        int fd = (int)syscall(SYS_perf_event_open, &atributos, 0, -1, -1, 0);
+        if (fd < 0)
+        {
+            fprintf(stderr, "Aviso: contador de %s indisponível (perf_event_open: %s)\n",
+                    eventos_contadores[c].nome, strerror(errno));
+            continue;
+        }
+
+        descritores_contadores[c] = fd;
+        abertos++;
+    }
+
+    return abertos;
+}
+
+/*
+    FecharContadores: fecha os contadores abertos por AbrirContadores.
+ */
+void FecharContadores()
+{
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        if (descritores_contadores[c] >= 0)
+        {
+            close(descritores_contadores[c]);
+            descritores_contadores[c] = -1;
+        }
+    }
+}
+
+// ============================================================
+//                  LEITURA DOS CONTADORES
+// ============================================================
+/*
+    Estrutura LeituraContadores: contagens de uma região medida (ou a mediana de várias).
+
+    Campos:
+        - valido: o contador estava aberto e chegou a ser contado
+        - valor: contagem, corrigida pela multiplexação
+ */
+struct LeituraContadores {
+    bool valido[NUM_CONTADORES];
+    double valor[NUM_CONTADORES];
+};
+
+/*
+    LerContador: lê a contagem, o tempo ativo e o tempo contando de um contador aberto.
+ */
+bool LerContador(int c, uint64_t valores[3])
+{
+    return read(descritores_contadores[c], valores, 3 * sizeof(uint64_t)) == (ssize_t)(3 * sizeof(uint64_t));
+}
+
+/*
+    base_contadores: leituras de IniciarContadores, subtraídas por PararContadores.
+ */
+static uint64_t base_contadores[NUM_CONTADORES][3];
+
+/*
+    IniciarContadores: guarda a leitura atual e ativa os contadores abertos (nada faz se não
+    houver nenhum).
+
+    Funcionamento:
+        - ENABLE no descritor original também vale para as cópias herdadas pelas threads
+        - As contagens são diferenças entre duas leituras, e não a leitura após um RESET:
+          o RESET não zera o que as threads já terminadas devolveram ao descritor original
+ */
+void IniciarContadores()
+{
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        if (descritores_contadores[c] < 0)
+            continue;
+
+        if (!LerContador(c, base_contadores[c]))
+        {
+            memset(base_contadores[c], 0, sizeof(base_contadores[c]));
+        }
+        ioctl(descritores_contadores[c], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+/*
+    PararContadores: desativa os contadores e lê as contagens desde IniciarContadores.
+
+    Funcionamento:
+        - Cada leitura traz a contagem, o tempo ativo (enabled) e o tempo em que o evento
+          ocupou um contador físico (running); a contagem é escalada por enabled / running
+        - Um contador que não chegou a ser contado (running == 0) fica inválido
+ */
+void PararContadores(LeituraContadores *leitura)
+{
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        if (descritores_contadores[c] >= 0)
+        {
+            ioctl(descritores_contadores[c], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        leitura->valido[c] = false;
+        leitura->valor[c] = 0;
+
+        uint64_t valores[3]; // contagem, tempo ativo, tempo contando
+        if (descritores_contadores[c] < 0 || !LerContador(c, valores))
+            continue;
+
+        double contagem = (double)(valores[0] - base_contadores[c][0]);
+        double ativo = (double)(valores[1] - base_contadores[c][1]);
+        double contando = (double)(valores[2] - base_contadores[c][2]);
+        if (contando <= 0)
+            continue;
+
+        leitura->valido[c] = true;
+        leitura->valor[c] = contagem * (ativo / contando);
+    }
+}
+
+/*
+    MedianaContadores: mediana de cada contador nas 'n' leituras (apenas as válidas).
+ */
+void MedianaContadores(const LeituraContadores *leituras, int n, LeituraContadores *mediana)
+{
+    double *valores = new double[n > 0 ? n : 1];
+
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        int validos = 0;
+        for (int i = 0; i < n; i++)
+        {
+            if (leituras[i].valido[c])
+                valores[validos++] = leituras[i].valor[c];
+        }
+
+        // Ordenação por inserção: são poucas repetições
+        for (int i = 1; i < validos; i++)
+        {
+            double valor = valores[i];
+            int j = i - 1;
+            while (j >= 0 && valores[j] > valor)
+            {
+                valores[j + 1] = valores[j];
+                j--;
+            }
+            valores[j + 1] = valor;
+        }
+
+        mediana->valido[c] = validos > 0;
+        mediana->valor[c] = validos == 0 ? 0
+                          : (validos % 2) ? valores[validos / 2]
+                                          : (valores[validos / 2 - 1] + valores[validos / 2]) / 2;
+    }
+
+    delete[] valores;
+}
+
+// ============================================================
+//                  SAÍDA DOS CONTADORES
+// ============================================================
+/*
+    EscreverContadores: escreve as colunas de CABECALHO_CONTADORES, cada uma precedida de
+    vírgula; contadores inválidos ficam vazios.
+ */
+void EscreverContadores(FILE *csv, const LeituraContadores *leitura)
+{
+    for (int c = 0; c < NUM_CONTADORES; c++)
+    {
+        if (leitura && leitura->valido[c])
+            fprintf(csv, ",%.0f", leitura->valor[c]);
+        else
+            fprintf(csv, ",");
+    }
+}
+
+/*
+    ImprimirContadores: imprime o IPC e as falhas por elemento de uma leitura, se houver
+    algum contador válido.
+ */
+void ImprimirContadores(const LeituraContadores *leitura, long tamanho)
+{
+    if (tamanho <= 0)
+        return;
+
+    char linha[256] = "";
+    size_t usado = 0;
+
+    if (leitura->valido[CICLOS] && leitura->valido[INSTRUCOES] && leitura->valor[CICLOS] > 0)
+    {
+        usado += snprintf(linha + usado, sizeof(linha) - usado, " IPC %.2f,",
+                          leitura->valor[INSTRUCOES] / leitura->valor[CICLOS]);
+    }
+
+    const Contador falhas[] = {FALHAS_DESVIO, FALHAS_LLC, FALHAS_DTLB};
+    for (int i = 0; i < 3 && usado < sizeof(linha); i++)
+    {
+        if (leitura->valido[falhas[i]])
+        {
+            usado += snprintf(linha + usado, sizeof(linha) - usado, " %s/elem %.3f,",
+                              eventos_contadores[falhas[i]].nome, leitura->valor[falhas[i]] / tamanho);
+        }
+    }
+
+    if (usado > 0)
+    {
+        linha[usado - 1] = '\0'; // remove a última vírgula
+        printf("    Contadores:%s\n", linha);
+    }
+}
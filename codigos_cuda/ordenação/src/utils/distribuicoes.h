@@ -0,0 +1,234 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo define as distribuições dos arquivos de entrada (int) usados nos testes.
+    Cada algoritmo se comporta de forma diferente conforme a entrada: o Merge Sort não ganha
+    nada com dados já ordenados, o Sample Sort precisa espalhar as repetições dos divisores
+    quando há poucos valores distintos, o Radix Sort pula passadas quando os valores são
+    pequenos, etc.
+
+    Distribuições:
+        - uniforme: inteiros uniformes entre 0 e 100 milhões (a entrada original do projeto)
+        - uniforme32: inteiros uniformes em toda a faixa de 32 bits, incluindo negativos
+        - ordenada: crescente (com repetições se n > 100 milhões)
+        - inversa: decrescente
+        - quase_ordenada: crescente com n / DIST_DIVISOR_TROCAS trocas de pares aleatórios
+        - poucos_unicos: DIST_VALORES_UNICOS valores distintos
+        - zipf: DIST_ZIPF_VALORES valores distintos com frequência ~ 1 / posto (Zipf s = 1)
+        - iguais: todos os elementos iguais
+        - serra: DIST_DENTES_SERRA sequências crescentes seguidas (dentes de serra)
+
+    Os valores são calculados a partir da posição e do número aleatório da posição
+    (PreencherParalelo), então a geração continua paralela e reprodutível. Apenas as trocas
+    da quase_ordenada são feitas depois, em sequência.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "gerador.h"
+
+#define DIST_DIVISOR_TROCAS 1000
+#define DIST_VALORES_UNICOS 16
+#define DIST_ZIPF_VALORES 1000000
+#define DIST_DENTES_SERRA 16
+#define DIST_FAIXA 100000000
+
+/*
+    DIST_DIVISOR_TROCAS: a quase_ordenada recebe n / DIST_DIVISOR_TROCAS trocas (0,1%).
+    DIST_VALORES_UNICOS: número de valores distintos da poucos_unicos.
+    DIST_ZIPF_VALORES: número de postos (valores distintos) da zipf.
+    DIST_DENTES_SERRA: número de sequências crescentes da serra.
+    DIST_FAIXA: os valores (exceto uniforme32) ficam entre 0 e DIST_FAIXA.
+*/
+
+enum Distribuicao {
+    DIST_UNIFORME,
+    DIST_UNIFORME_32,
+    DIST_ORDENADA,
+    DIST_INVERSA,
+    DIST_QUASE_ORDENADA,
+    DIST_POUCOS_UNICOS,
+    DIST_ZIPF,
+    DIST_IGUAIS,
+    DIST_SERRA,
+    NUM_DISTRIBUICOES
+};
+
+/*
+    NomeDistribuicao: nome da distribuição, usado nas mensagens e na coluna Distribuicao dos CSVs.
+ */
+const char *NomeDistribuicao(Distribuicao distribuicao)
+{
+    switch (distribuicao)
+    {
+        case DIST_UNIFORME:       return "uniforme";
+        case DIST_UNIFORME_32:    return "uniforme32";
+        case DIST_ORDENADA:       return "ordenada";
+        case DIST_INVERSA:        return "inversa";
+        case DIST_QUASE_ORDENADA: return "quase_ordenada";
+        case DIST_POUCOS_UNICOS:  return "poucos_unicos";
+        case DIST_ZIPF:           return "zipf";
+        case DIST_IGUAIS:         return "iguais";
+        case DIST_SERRA:          return "serra";
+        default:                  return "desconhecida";
+    }
+}
+
+/*
+    DistribuicaoPorNome: procura a distribuição com o nome dado (o de NomeDistribuicao).
+
+    Retorno:
+        - true e a distribuição em 'distribuicao' se o nome existir; false caso contrário
+ */
+bool DistribuicaoPorNome(const char *nome, Distribuicao *distribuicao)
+{
+    for (int d = 0; d < NUM_DISTRIBUICOES; d++)
+    {
+        if (strcmp(nome, NomeDistribuicao((Distribuicao)d)) == 0)
+        {
+            *distribuicao = (Distribuicao)d;
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+    DistribuicaoTemNegativos: verdadeiro se a distribuição gera valores negativos
+    (o RadixSort decimal só ordena valores não negativos).
+ */
+bool DistribuicaoTemNegativos(Distribuicao distribuicao)
+{
+    return distribuicao == DIST_UNIFORME_32;
+}
+
+// ============================================================
+//                  GERADOR DAS DISTRIBUIÇÕES
+// ============================================================
+/*
+    Estrutura GeradorDistribuicao: calcula o elemento da posição i para uma distribuição.
+
+    Campos:
+        - tipo: distribuição
+        - n: número de elementos do arquivo
+        - tamanho_dente: número de elementos de cada dente da serra
+ */
+struct GeradorDistribuicao {
+    Distribuicao tipo;
+    long n;
+    long tamanho_dente;
+
+    int operator()(long i, uint64_t aleatorio) const
+    {
+        switch (tipo)
+        {
+            case DIST_UNIFORME_32:
+                return (int)(uint32_t)aleatorio;
+            case DIST_ORDENADA:
+            case DIST_QUASE_ORDENADA:
+                return (int)((double)i * DIST_FAIXA / n);
+            case DIST_INVERSA:
+                return (int)((double)(n - 1 - i) * DIST_FAIXA / n);
+            case DIST_POUCOS_UNICOS:
+                return (int)(aleatorio % DIST_VALORES_UNICOS) * (DIST_FAIXA / DIST_VALORES_UNICOS);
+            case DIST_ZIPF:
+            {
+                // Aproximação contínua da Zipf (s = 1): posto = floor((M + 1)^u), u uniforme
+                // em [0, 1). Os postos são espalhados pela faixa de valores com o SplitMix64.
+                double u = (double)(aleatorio >> 11) * (1.0 / 9007199254740992.0);
+                uint64_t posto = (uint64_t)pow((double)DIST_ZIPF_VALORES + 1.0, u);
+                return (int)(MisturarSplitMix64(posto) % DIST_FAIXA);
+            }
+            case DIST_IGUAIS:
+                return DIST_FAIXA / 2;
+            case DIST_SERRA:
+                return (int)((double)(i % tamanho_dente) * DIST_FAIXA / tamanho_dente);
+            case DIST_UNIFORME:
+            default:
+                return (int)(aleatorio % DIST_FAIXA);
+        }
+    }
+};
+
+/*
+    CriarGeradorDistribuicao: gerador dos 'n' elementos de um arquivo na distribuição pedida.
+ */
+GeradorDistribuicao CriarGeradorDistribuicao(Distribuicao distribuicao, long n)
+{
+    GeradorDistribuicao gerador;
+    gerador.tipo = distribuicao;
+    gerador.n = n;
+    gerador.tamanho_dente = (n + DIST_DENTES_SERRA - 1) / DIST_DENTES_SERRA;
+    return gerador;
+}
+
+/*
+    SementeDistribuicao: semente de um arquivo com 'n' elementos na distribuição pedida.
+ */
+static inline uint64_t SementeDistribuicao(uint64_t semente, Distribuicao distribuicao, long n)
+{
+    return SementeArquivo(semente ^ (uint64_t)distribuicao, n);
+}
+
+/*
+    AplicarTrocas: troca 'trocas' pares de posições aleatórias do vetor.
+        - As posições vêm de uma sequência do SplitMix64 separada da usada nos valores.
+ */
+void AplicarTrocas(int *dados, long n, long trocas, uint64_t semente)
+{
+    uint64_t contador = MisturarSplitMix64(semente ^ SPLITMIX_GAMA);
+    for (long t = 0; t < trocas; t++)
+    {
+        contador += SPLITMIX_GAMA;
+        long a = (long)(MisturarSplitMix64(contador) % (uint64_t)n);
+        contador += SPLITMIX_GAMA;
+        long b = (long)(MisturarSplitMix64(contador) % (uint64_t)n);
+
+        int temp = dados[a];
+        dados[a] = dados[b];
+        dados[b] = temp;
+    }
+}
+
+/*
+    GerarArquivoDistribuicao: gera um arquivo binário com 'n' inteiros na distribuição pedida.
+
+    Parâmetros:
+        - caminho: arquivo a ser criado (ou sobrescrito)
+        - n: número de elementos
+        - distribuicao: distribuição dos valores
+        - semente: semente geral; os mesmos (semente, n, distribuicao) geram sempre o mesmo arquivo
+        - assinatura: se não for NULL, recebe a assinatura dos valores do arquivo (as trocas da
+          quase_ordenada não a alteram)
+
+    Retorno:
+        - true em caso de sucesso
+ */
+bool GerarArquivoDistribuicao(const char *caminho, long n, Distribuicao distribuicao, uint64_t semente,
+                              AssinaturaMulticonjunto *assinatura = NULL)
+{
+    ArquivoMapeado arquivo;
+    if (!CriarArquivoMapeado(caminho, (size_t)n * sizeof(int), &arquivo))
+    {
+        return false;
+    }
+
+    uint64_t semente_arquivo = SementeDistribuicao(semente, distribuicao, n);
+    PreencherParalelo<int>((int *)arquivo.dados, n, semente_arquivo, CriarGeradorDistribuicao(distribuicao, n),
+                           assinatura);
+
+    if (distribuicao == DIST_QUASE_ORDENADA && n > 1)
+    {
+        AplicarTrocas((int *)arquivo.dados, n, n / DIST_DIVISOR_TROCAS, semente_arquivo);
+    }
+
+    DesmapearArquivo(&arquivo);
+    return true;
+}
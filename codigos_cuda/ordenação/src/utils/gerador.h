@@ -0,0 +1,305 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa a geração paralela dos arquivos binários de entrada.
+    O fluxo geral é:
+        1. Cria o arquivo com o tamanho final e o mapeia em memória (CriarArquivoMapeado)
+        2. Divide o vetor em faixas contíguas, uma por thread
+        3. Cada thread preenche a sua faixa com valores pseudoaleatórios
+        4. Desmapeia o arquivo; o kernel grava as páginas no disco
+
+    O valor da posição i é calculado diretamente a partir de (semente, i) com a função de
+    mistura do SplitMix64, um gerador baseado em contador: não há estado compartilhado
+    entre as threads, e o conteúdo de um arquivo depende apenas da semente e do seu tamanho,
+    qualquer que seja o número de threads.
+
+    Durante a geração também é calculada a assinatura do multiconjunto de valores do arquivo
+    (AssinaturaMulticonjunto), que não depende da ordem dos elementos: depois da ordenação,
+    o VerificarOrdenado a compara com a do arquivo ordenado para detectar elementos perdidos,
+    duplicados ou alterados.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "arquivo_mapeado.h"
+
+#define SEMENTE_PADRAO 42
+#define SPLITMIX_GAMA 0x9E3779B97F4A7C15ull
+
+/*
+    SEMENTE_PADRAO: semente usada quando nenhuma outra é informada.
+    SPLITMIX_GAMA: incremento do contador do SplitMix64 (parte fracionária da razão áurea).
+*/
+
+// ============================================================
+//                  GERADOR PSEUDOALEATÓRIO
+// ============================================================
+/*
+    MisturarSplitMix64: função de mistura (finalizador) do SplitMix64.
+
+    Funcionamento:
+        - Leva contadores consecutivos a valores de 64 bits sem correlação aparente;
+          o i-ésimo valor de uma sequência é MisturarSplitMix64(semente + (i + 1) * SPLITMIX_GAMA)
+ */
+static inline uint64_t MisturarSplitMix64(uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+/*
+    SementeArquivo: semente de um arquivo com 'n' elementos, derivada da semente geral.
+        - Arquivos de tamanhos diferentes recebem sequências independentes.
+ */
+static inline uint64_t SementeArquivo(uint64_t semente, long n)
+{
+    return MisturarSplitMix64(semente ^ MisturarSplitMix64((uint64_t)n));
+}
+
+/*
+    ThreadsParaElementos: número de threads para percorrer 'n' elementos em paralelo.
+        - Uma thread por processador disponível, limitado para que cada thread processe
+          pelo menos 2^16 elementos
+ */
+static inline long ThreadsParaElementos(long n)
+{
+    long processadores = sysconf(_SC_NPROCESSORS_ONLN);
+    long num_threads = n >> 16;
+    if (num_threads > processadores)
+        num_threads = processadores;
+    if (num_threads < 1)
+        num_threads = 1;
+    return num_threads;
+}
+
+// ============================================================
+//                  ASSINATURA DO MULTICONJUNTO
+// ============================================================
+/*
+    Estrutura AssinaturaMulticonjunto: resumo dos valores de um arquivo que não depende da
+    ordem dos elementos.
+
+    Campos:
+        - elementos: número de elementos
+        - soma: soma (módulo 2^64) do hash de cada valor
+        - ou_exclusivo: ou exclusivo do hash de cada valor
+
+    Uma ordenação correta preserva a assinatura; perder, duplicar ou alterar um elemento
+    muda a soma (e quase sempre o ou exclusivo) com probabilidade próxima de 1.
+ */
+struct AssinaturaMulticonjunto {
+    long elementos;
+    uint64_t soma;
+    uint64_t ou_exclusivo;
+};
+
+/*
+    HashValor: hash de 64 bits dos bits de um valor do tipo T.
+        - SPLITMIX_GAMA é somado para que o valor 0 não tenha hash 0
+        - Tipos maiores que 8 bytes (registros, registros.h) são lidos em palavras de 8 bytes,
+          cada uma misturada ao hash das anteriores; não podem ter bytes de preenchimento,
+          cujo conteúdo é indefinido
+ */
+template <typename T>
+static inline uint64_t HashValor(const T &valor)
+{
+    const unsigned char *bytes = (const unsigned char *)&valor;
+    uint64_t hash = 0;
+    for (size_t inicio = 0; inicio < sizeof(T); inicio += sizeof(uint64_t))
+    {
+        uint64_t bits = 0;
+        size_t restante = sizeof(T) - inicio;
+        memcpy(&bits, bytes + inicio, restante < sizeof(uint64_t) ? restante : sizeof(uint64_t));
+        hash = MisturarSplitMix64(hash ^ (bits + SPLITMIX_GAMA));
+    }
+    return hash;
+}
+
+/*
+    IniciarAssinatura / AcumularAssinatura / CombinarAssinaturas: assinatura vazia, inclusão
+    de um hash e união das assinaturas de duas partes do vetor.
+ */
+static inline void IniciarAssinatura(AssinaturaMulticonjunto *assinatura)
+{
+    assinatura->elementos = 0;
+    assinatura->soma = 0;
+    assinatura->ou_exclusivo = 0;
+}
+
+static inline void AcumularAssinatura(AssinaturaMulticonjunto *assinatura, uint64_t hash)
+{
+    assinatura->elementos++;
+    assinatura->soma += hash;
+    assinatura->ou_exclusivo ^= hash;
+}
+
+static inline void CombinarAssinaturas(AssinaturaMulticonjunto *destino, const AssinaturaMulticonjunto *parte)
+{
+    destino->elementos += parte->elementos;
+    destino->soma += parte->soma;
+    destino->ou_exclusivo ^= parte->ou_exclusivo;
+}
+
+static inline bool AssinaturasIguais(const AssinaturaMulticonjunto *a, const AssinaturaMulticonjunto *b)
+{
+    return a->elementos == b->elementos && a->soma == b->soma && a->ou_exclusivo == b->ou_exclusivo;
+}
+
+// ============================================================
+//                  Estrutura de dados para threads
+// ============================================================
+/*
+    Estrutura GeradorThreadDados: faixa do vetor preenchida por uma thread.
+
+    Campos:
+        - dados: início do arquivo mapeado
+        - inicio: índice inicial (inclusivo) da faixa
+        - fim: índice final (exclusivo) da faixa
+        - semente: semente do arquivo
+        - gerador: objeto com operator()(long i, uint64_t aleatorio), que calcula o elemento
+          da posição i a partir do número aleatório dessa posição
+        - assinatura: assinatura dos valores gerados pela thread (saída)
+ */
+template <typename T, typename G>
+struct GeradorThreadDados {
+    T *dados;
+    long inicio;
+    long fim;
+    uint64_t semente;
+    const G *gerador;
+    AssinaturaMulticonjunto assinatura;
+};
+
+/*
+    ThreadGerador: preenche a faixa [inicio, fim) com os valores das posições correspondentes
+    e calcula a assinatura dos valores gerados.
+ */
+template <typename T, typename G>
+void *ThreadGerador(void *arg)
+{
+    GeradorThreadDados<T, G> *dados = (GeradorThreadDados<T, G> *)arg;
+    const G &gerador = *dados->gerador;
+
+    AssinaturaMulticonjunto assinatura;
+    IniciarAssinatura(&assinatura);
+
+    uint64_t contador = dados->semente + (uint64_t)dados->inicio * SPLITMIX_GAMA;
+    for (long i = dados->inicio; i < dados->fim; i++)
+    {
+        contador += SPLITMIX_GAMA;
+        T valor = gerador(i, MisturarSplitMix64(contador));
+        dados->dados[i] = valor;
+        AcumularAssinatura(&assinatura, HashValor<T>(valor));
+    }
+
+    dados->assinatura = assinatura;
+
+    pthread_exit(0);
+}
+
+/*
+    Estrutura GeradorValor: gerador que ignora a posição e apenas converte o número aleatório
+    com a função 'valor' (distribuição uniforme).
+ */
+template <typename T>
+struct GeradorValor {
+    T (*valor)(uint64_t aleatorio);
+
+    T operator()(long, uint64_t aleatorio) const
+    {
+        return valor(aleatorio);
+    }
+};
+
+// ============================================================
+//                  FUNÇÕES PRINCIPAIS DO GERADOR
+// ============================================================
+/*
+    PreencherParalelo: preenche dados[0..n) em paralelo com o gerador 'gerador'.
+
+    Parâmetros:
+        - dados: vetor (normalmente um arquivo mapeado)
+        - n: número de elementos
+        - semente: semente do arquivo (SementeArquivo)
+        - gerador: ver GeradorThreadDados
+        - assinatura: se não for NULL, recebe a assinatura dos valores gerados
+
+    Funcionamento:
+        - Usa ThreadsParaElementos(n) threads, cada uma com uma faixa contígua
+ */
+template <typename T, typename G>
+void PreencherParalelo(T *dados, long n, uint64_t semente, const G &gerador,
+                       AssinaturaMulticonjunto *assinatura = NULL)
+{
+    long num_threads = ThreadsParaElementos(n);
+
+    pthread_t *threads = new pthread_t[num_threads];
+    GeradorThreadDados<T, G> *args = new GeradorThreadDados<T, G>[num_threads];
+
+    for (long t = 0; t < num_threads; t++)
+    {
+        args[t].dados = dados;
+        args[t].inicio = (n * t) / num_threads;
+        args[t].fim = (n * (t + 1)) / num_threads;
+        args[t].semente = semente;
+        args[t].gerador = &gerador;
+
+        pthread_create(&threads[t], NULL, ThreadGerador<T, G>, &args[t]);
+    }
+
+    if (assinatura)
+    {
+        IniciarAssinatura(assinatura);
+    }
+    for (long t = 0; t < num_threads; t++)
+    {
+        pthread_join(threads[t], NULL);
+        if (assinatura)
+        {
+            CombinarAssinaturas(assinatura, &args[t].assinatura);
+        }
+    }
+
+    delete[] threads;
+    delete[] args;
+}
+
+/*
+    GerarArquivoParalelo: gera um arquivo binário com 'n' elementos do tipo T.
+
+    Parâmetros:
+        - caminho: arquivo a ser criado (ou sobrescrito)
+        - n: número de elementos
+        - semente: semente geral; o mesmo par (semente, n) gera sempre o mesmo arquivo
+        - valor: converte um número aleatório de 64 bits em um elemento do tipo T
+        - assinatura: se não for NULL, recebe a assinatura dos valores do arquivo
+
+    Retorno:
+        - true em caso de sucesso
+ */
+template <typename T>
+bool GerarArquivoParalelo(const char *caminho, long n, uint64_t semente, T (*valor)(uint64_t),
+                          AssinaturaMulticonjunto *assinatura = NULL)
+{
+    ArquivoMapeado arquivo;
+    if (!CriarArquivoMapeado(caminho, (size_t)n * sizeof(T), &arquivo))
+    {
+        return false;
+    }
+
+    GeradorValor<T> gerador;
+    gerador.valor = valor;
+    PreencherParalelo<T>((T *)arquivo.dados, n, SementeArquivo(semente, n), gerador, assinatura);
+
+    DesmapearArquivo(&arquivo);
+    return true;
+}
@@ -0,0 +1,494 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa a leitura das opções de linha de comando do programa principal.
+    O fluxo geral é:
+        1. OpcoesPadrao preenche as opções com os valores que antes eram fixos no main.cu
+           (tamanhos de 250 mil a 100 milhões, 8 threads, todas as distribuições, ...)
+        2. LerOpcoes lê os argumentos com getopt_long, substituindo os valores padrão
+        3. O main executa os algoritmos escolhidos com as opções lidas
+
+    Assim é possível executar apenas alguns algoritmos, tamanhos ou números de threads em
+    outra máquina sem recompilar. Os nomes dos algoritmos são os do registro do main.cu
+    (main --listar).
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <getopt.h>
+
+#include "distribuicoes.h"
+#include "selecao.h"
+#include "pipeline_es.h"
+
+#define MAX_LISTA_OPCOES 64
+
+/*
+    MAX_LISTA_OPCOES: número máximo de itens em cada lista de opções (algoritmos, tamanhos,
+    threads).
+*/
+
+// ============================================================
+//                  Estrutura das opções
+// ============================================================
+/*
+    Estrutura OpcoesBenchmark: opções de uma execução do programa principal.
+
+    Campos:
+        - algoritmos / num_algoritmos: nomes dos algoritmos a executar (nenhum = todos)
+        - tamanhos / num_tamanhos: número de elementos de cada arquivo de entrada
+        - threads / num_threads: números de threads das versões paralelas (cada algoritmo com
+          threads é executado uma vez para cada valor)
+        - distribuicoes / num_distribuicoes: distribuições das entradas
+        - repeticoes: execuções medidas de cada arquivo (os CSVs recebem as estatísticas)
+        - aquecimento: execuções de aquecimento, antes das medidas, que não são registradas
+        - fixar_threads: fixa as threads das ordenações nos núcleos (medicao.h)
+        - contadores: lê os contadores de desempenho em cada ordenação (contadores.h)
+        - csv_saida: CSV geral dos tempos
+        - semente: semente do gerador das entradas
+        - memoria_externo: orçamento de memória do Merge Sort externo, em bytes
+        - fracao_selecao: fração dos elementos selecionados pelos modos de seleção (selecao.h)
+        - buffers_pipeline: buffers do pipeline de E/S (pipeline_es.h); 0 usa os arquivos mapeados
+        - listar: apenas lista os algoritmos disponíveis
+ */
+struct OpcoesBenchmark {
+    const char *algoritmos[MAX_LISTA_OPCOES];
+    int num_algoritmos;
+    long tamanhos[MAX_LISTA_OPCOES];
+    int num_tamanhos;
+    int threads[MAX_LISTA_OPCOES];
+    int num_threads;
+    Distribuicao distribuicoes[NUM_DISTRIBUICOES];
+    int num_distribuicoes;
+    int repeticoes;
+    int aquecimento;
+    bool fixar_threads;
+    bool contadores;
+    const char *csv_saida;
+    uint64_t semente;
+    long memoria_externo;
+    double fracao_selecao;
+    int buffers_pipeline;
+    bool listar;
+};
+
+/*
+    OpcoesPadrao: opções usadas quando nenhum argumento é informado.
+ */
+void OpcoesPadrao(OpcoesBenchmark *opcoes)
+{
+    const long tamanhos[] = {
+        250000, 500000, 750000, 1000000,
+        2500000, 5000000, 7500000, 10000000,
+        25000000, 50000000, 100000000
+    };
+
+    opcoes->num_algoritmos = 0;
+
+    opcoes->num_tamanhos = (int)(sizeof(tamanhos) / sizeof(tamanhos[0]));
+    for (int i = 0; i < opcoes->num_tamanhos; i++)
+    {
+        opcoes->tamanhos[i] = tamanhos[i];
+    }
+
+    opcoes->threads[0] = 8;
+    opcoes->num_threads = 1;
+
+    opcoes->num_distribuicoes = NUM_DISTRIBUICOES;
+    for (int d = 0; d < NUM_DISTRIBUICOES; d++)
+    {
+        opcoes->distribuicoes[d] = (Distribuicao)d;
+    }
+
+    opcoes->repeticoes = 1;
+    opcoes->aquecimento = 0;
+    opcoes->fixar_threads = false;
+    opcoes->contadores = false;
+    opcoes->csv_saida = "results/tempos.csv";
+    opcoes->semente = SEMENTE_PADRAO;
+
+    // Menor que os maiores arquivos, que são então ordenados em várias runs
+    opcoes->memoria_externo = 64L * 1024 * 1024;
+    opcoes->fracao_selecao = FRACAO_SELECAO_PADRAO;
+    opcoes->buffers_pipeline = 0;
+    opcoes->listar = false;
+}
+
+/*
+    OpcoesGrande: teste de entrada grande (--grande): um arquivo com 2^31 + 1000 inteiros,
+    ordenado pelas versões que aceitam mais de 2^31 elementos, com os tempos em
+    results/tempos_grande.csv.
+        - As ordenações em memória precisam de cerca de 16 GB (o arquivo mapeado e o buffer
+          auxiliar), e a versão CUDA de 16 GB na GPU
+ */
+void OpcoesGrande(OpcoesBenchmark *opcoes)
+{
+    static const char *algoritmos[] = {
+        "merge_seq_pingpong", "merge_threads", "sample_threads", "radix_seq_base256",
+        "radix_threads", "merge_cuda", "merge_externo"
+    };
+
+    opcoes->num_algoritmos = (int)(sizeof(algoritmos) / sizeof(algoritmos[0]));
+    for (int i = 0; i < opcoes->num_algoritmos; i++)
+    {
+        opcoes->algoritmos[i] = algoritmos[i];
+    }
+
+    opcoes->tamanhos[0] = (1L << 31) + 1000;
+    opcoes->num_tamanhos = 1;
+    opcoes->distribuicoes[0] = DIST_UNIFORME;
+    opcoes->num_distribuicoes = 1;
+    opcoes->csv_saida = "results/tempos_grande.csv";
+}
+
+// ============================================================
+//                  LEITURA DOS VALORES
+// ============================================================
+/*
+    LerNumero: lê um número com sufixo opcional k, m ou g (ex.: 250k, 2.5m, 64m).
+
+    Parâmetros:
+        - texto: texto a ser lido
+        - base: multiplicador de cada sufixo (1000 para quantidades, 1024 para bytes)
+        - valor: número lido
+
+    Retorno:
+        - true se o texto for um número válido e positivo
+ */
+bool LerNumero(const char *texto, long base, long *valor)
+{
+    char *fim;
+    double numero = strtod(texto, &fim);
+    if (fim == texto)
+    {
+        return false;
+    }
+
+    switch (*fim)
+    {
+        case 'k': case 'K': numero *= base; fim++; break;
+        case 'm': case 'M': numero *= (double)base * base; fim++; break;
+        case 'g': case 'G': numero *= (double)base * base * base; fim++; break;
+        default: break;
+    }
+
+    if (*fim != '\0' || numero <= 0)
+    {
+        return false;
+    }
+
+    *valor = (long)(numero + 0.5);
+    return true;
+}
+
+/*
+    LerLista: separa 'texto' (alterado no lugar) nos itens separados por vírgula.
+
+    Retorno:
+        - número de itens, ou -1 se houver mais de 'maximo' itens
+ */
+int LerLista(char *texto, char **itens, int maximo)
+{
+    int num_itens = 0;
+    char *resto;
+    for (char *item = strtok_r(texto, ",", &resto); item; item = strtok_r(NULL, ",", &resto))
+    {
+        if (num_itens == maximo)
+        {
+            return -1;
+        }
+        itens[num_itens++] = item;
+    }
+    return num_itens;
+}
+
+/*
+    ImprimirAjuda: imprime as opções aceitas pelo programa.
+ */
+void ImprimirAjuda(const char *programa)
+{
+    printf("Uso: %s [opções]\n\n", programa);
+    printf("  -a, --algoritmos LISTA     algoritmos a executar, separados por vírgula (padrão: todos)\n");
+    printf("  -n, --tamanhos LISTA       tamanhos das entradas, aceita k/m/g (padrão: 250k,...,100m)\n");
+    printf("  -t, --threads LISTA        números de threads das versões paralelas (padrão: 8)\n");
+    printf("  -d, --distribuicoes LISTA  distribuições das entradas (padrão: todas)\n");
+    printf("  -r, --repeticoes N         execuções medidas de cada arquivo (padrão: 1)\n");
+    printf("  -w, --aquecimento N        execuções de aquecimento, não registradas (padrão: 0)\n");
+    printf("  -p, --fixar-threads        fixa cada thread das ordenações em um núcleo\n");
+    printf("  -c, --contadores           lê ciclos, instruções e falhas de desvio, LLC e dTLB (perf_event_open)\n");
+    printf("  -o, --saida ARQUIVO        CSV geral dos tempos (padrão: results/tempos.csv)\n");
+    printf("  -s, --semente N            semente do gerador das entradas (padrão: %d)\n", SEMENTE_PADRAO);
+    printf("  -m, --memoria-externo N    memória do Merge Sort externo em bytes, aceita k/m/g (padrão: 64m)\n");
+    printf("  -k, --selecao FRAÇÃO       fração selecionada pelos modos de seleção, ex.: 0.01 ou 1%% (padrão: 1%%)\n");
+    printf("  -b, --buffers N            lê, ordena e grava os arquivos em pipeline com N buffers, de 1 a %d\n"
+           "                             (padrão: 0, arquivos mapeados; vazão em %s)\n", MAX_BUFFERS_PIPELINE, CSV_PIPELINE);
+    printf("      --grande               teste com 2^31 + 1000 elementos (results/tempos_grande.csv)\n");
+    printf("  -l, --listar               lista os algoritmos disponíveis\n");
+    printf("  -h, --ajuda                mostra esta mensagem\n\n");
+
+    printf("Distribuições:");
+    for (int d = 0; d < NUM_DISTRIBUICOES; d++)
+    {
+        printf(" %s", NomeDistribuicao((Distribuicao)d));
+    }
+    printf("\n");
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL DA LEITURA
+// ============================================================
+/*
+    LerOpcoes: lê as opções de linha de comando sobre os valores de OpcoesPadrao.
+
+    Parâmetros:
+        - argc, argv: argumentos do main (as listas são separadas no próprio argv)
+        - opcoes: opções preenchidas
+
+    Retorno:
+        - true se o programa deve continuar; false em caso de erro ou após imprimir a ajuda
+          (com 'codigo' recebendo o código de saída)
+
+    Funcionamento:
+        - As opções são aplicadas na ordem em que aparecem; --grande substitui algoritmos,
+          tamanhos, distribuições e saída, que ainda podem ser alterados pelas opções seguintes
+ */
+bool LerOpcoes(int argc, char **argv, OpcoesBenchmark *opcoes, int *codigo)
+{
+    static const struct option longas[] = {
+        {"algoritmos",      required_argument, NULL, 'a'},
+        {"tamanhos",        required_argument, NULL, 'n'},
+        {"threads",         required_argument, NULL, 't'},
+        {"distribuicoes",   required_argument, NULL, 'd'},
+        {"repeticoes",      required_argument, NULL, 'r'},
+        {"aquecimento",     required_argument, NULL, 'w'},
+        {"fixar-threads",   no_argument,       NULL, 'p'},
+        {"contadores",      no_argument,       NULL, 'c'},
+        {"saida",           required_argument, NULL, 'o'},
+        {"semente",         required_argument, NULL, 's'},
+        {"memoria-externo", required_argument, NULL, 'm'},
+        {"selecao",         required_argument, NULL, 'k'},
+        {"buffers",         required_argument, NULL, 'b'},
+        {"grande",          no_argument,       NULL, 'G'},
+        {"listar",          no_argument,       NULL, 'l'},
+        {"ajuda",           no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    OpcoesPadrao(opcoes);
+    *codigo = 1;
+
+    char *itens[MAX_LISTA_OPCOES];
+    int num_itens;
+    int opcao;
+    while ((opcao = getopt_long(argc, argv, "a:n:t:d:r:w:pco:s:m:k:b:lh", longas, NULL)) != -1)
+    {
+        switch (opcao)
+        {
+            case 'a':
+                num_itens = LerLista(optarg, itens, MAX_LISTA_OPCOES);
+                if (num_itens < 0)
+                {
+                    fprintf(stderr, "Algoritmos demais (máximo %d)\n", MAX_LISTA_OPCOES);
+                    return false;
+                }
+                opcoes->num_algoritmos = 0;
+                for (int i = 0; i < num_itens; i++)
+                {
+                    if (strcmp(itens[i], "todos") == 0)
+                    {
+                        if (num_itens > 1)
+                        {
+                            fprintf(stderr, "'todos' não pode ser combinado com outros algoritmos\n");
+                            return false;
+                        }
+                        continue;
+                    }
+                    opcoes->algoritmos[opcoes->num_algoritmos++] = itens[i];
+                }
+                break;
+
+            case 'n':
+                num_itens = LerLista(optarg, itens, MAX_LISTA_OPCOES);
+                if (num_itens <= 0)
+                {
+                    fprintf(stderr, "Lista de tamanhos inválida (máximo %d)\n", MAX_LISTA_OPCOES);
+                    return false;
+                }
+                for (int i = 0; i < num_itens; i++)
+                {
+                    if (!LerNumero(itens[i], 1000, &opcoes->tamanhos[i]))
+                    {
+                        fprintf(stderr, "Tamanho inválido: %s\n", itens[i]);
+                        return false;
+                    }
+                }
+                opcoes->num_tamanhos = num_itens;
+                break;
+
+            case 't':
+                num_itens = LerLista(optarg, itens, MAX_LISTA_OPCOES);
+                if (num_itens <= 0)
+                {
+                    fprintf(stderr, "Lista de threads inválida (máximo %d)\n", MAX_LISTA_OPCOES);
+                    return false;
+                }
+                for (int i = 0; i < num_itens; i++)
+                {
+                    char *fim;
+                    long numero = strtol(itens[i], &fim, 10);
+                    if (*itens[i] == '\0' || *fim != '\0' || numero < 1 || numero > 4096)
+                    {
+                        fprintf(stderr, "Número de threads inválido: %s\n", itens[i]);
+                        return false;
+                    }
+                    opcoes->threads[i] = (int)numero;
+                }
+                opcoes->num_threads = num_itens;
+                break;
+
+            case 'd':
+                num_itens = LerLista(optarg, itens, MAX_LISTA_OPCOES);
+                if (num_itens <= 0)
+                {
+                    fprintf(stderr, "Lista de distribuições inválida\n");
+                    return false;
+                }
+                opcoes->num_distribuicoes = 0;
+                for (int i = 0; i < num_itens; i++)
+                {
+                    if (strcmp(itens[i], "todas") == 0)
+                    {
+                        for (int d = 0; d < NUM_DISTRIBUICOES && opcoes->num_distribuicoes < NUM_DISTRIBUICOES; d++)
+                        {
+                            opcoes->distribuicoes[opcoes->num_distribuicoes++] = (Distribuicao)d;
+                        }
+                        continue;
+                    }
+
+                    Distribuicao distribuicao;
+                    if (!DistribuicaoPorNome(itens[i], &distribuicao))
+                    {
+                        fprintf(stderr, "Distribuição desconhecida: %s\n", itens[i]);
+                        return false;
+                    }
+                    if (opcoes->num_distribuicoes == NUM_DISTRIBUICOES)
+                    {
+                        fprintf(stderr, "Distribuições demais\n");
+                        return false;
+                    }
+                    opcoes->distribuicoes[opcoes->num_distribuicoes++] = distribuicao;
+                }
+                break;
+
+            case 'r':
+            case 'w':
+            {
+                char *fim;
+                long numero = strtol(optarg, &fim, 10);
+                if (*optarg == '\0' || *fim != '\0' || numero < (opcao == 'r' ? 1 : 0) || numero > 1000000)
+                {
+                    fprintf(stderr, "Número de %s inválido: %s\n", opcao == 'r' ? "repetições" : "aquecimentos", optarg);
+                    return false;
+                }
+                if (opcao == 'r')
+                    opcoes->repeticoes = (int)numero;
+                else
+                    opcoes->aquecimento = (int)numero;
+                break;
+            }
+
+            case 'p':
+                opcoes->fixar_threads = true;
+                break;
+
+            case 'c':
+                opcoes->contadores = true;
+                break;
+
+            case 'o':
+                opcoes->csv_saida = optarg;
+                break;
+
+            case 's':
+            {
+                char *fim;
+                opcoes->semente = strtoull(optarg, &fim, 0);
+                if (*optarg == '\0' || *fim != '\0')
+                {
+                    fprintf(stderr, "Semente inválida: %s\n", optarg);
+                    return false;
+                }
+                break;
+            }
+
+            case 'm':
+                if (!LerNumero(optarg, 1024, &opcoes->memoria_externo))
+                {
+                    fprintf(stderr, "Memória inválida: %s\n", optarg);
+                    return false;
+                }
+                break;
+
+            case 'k':
+            {
+                char *fim;
+                double fracao = strtod(optarg, &fim);
+                if (*fim == '%')
+                {
+                    fracao /= 100;
+                    fim++;
+                }
+                if (fim == optarg || *fim != '\0' || !(fracao > 0 && fracao <= 1))
+                {
+                    fprintf(stderr, "Fração de seleção inválida: %s\n", optarg);
+                    return false;
+                }
+                opcoes->fracao_selecao = fracao;
+                break;
+            }
+
+            case 'b':
+            {
+                char *fim;
+                long numero = strtol(optarg, &fim, 10);
+                if (*optarg == '\0' || *fim != '\0' || numero < 0 || numero > MAX_BUFFERS_PIPELINE)
+                {
+                    fprintf(stderr, "Número de buffers inválido: %s (0 a %d)\n", optarg, MAX_BUFFERS_PIPELINE);
+                    return false;
+                }
+                opcoes->buffers_pipeline = (int)numero;
+                break;
+            }
+
+            case 'G':
+                OpcoesGrande(opcoes);
+                break;
+
+            case 'l':
+                opcoes->listar = true;
+                break;
+
+            case 'h':
+                ImprimirAjuda(argv[0]);
+                *codigo = 0;
+                return false;
+
+            default:
+                ImprimirAjuda(argv[0]);
+                return false;
+        }
+    }
+
+    if (optind < argc)
+    {
+        fprintf(stderr, "Argumento inesperado: %s\n", argv[optind]);
+        return false;
+    }
+
+    return true;
+}
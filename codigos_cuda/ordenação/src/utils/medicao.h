@@ -0,0 +1,390 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa a camada de medição de tempo compartilhada pelas funções Exec*.
+    O fluxo geral é:
+        1. O main define em config_medicao o número de repetições e de execuções de
+           aquecimento, a função que restaura uma entrada e se as threads são fixadas
+        2. Os Exec* (ExecOrdenacaoMapeada, ExecMergeExterno) executam cada arquivo
+           aquecimento + repeticoes vezes, restaurando a entrada antes de cada execução,
+           e guardam os tempos das repetições
+        3. CalcularEstatisticas resume os tempos (mínimo, mediana, p90, desvio padrão) e
+           EscreverEstatisticas os grava no CSV, com a vazão em elementos por segundo
+        4. O CSV geral também recebe o modelo da CPU e o número de núcleos (ModeloCPU,
+           NucleosDisponiveis), para comparar resultados de máquinas diferentes
+        5. Com --contadores, a ordenação também é medida pelos contadores de desempenho
+           (contadores.h), gravados nas colunas de CABECALHO_CONTADORES
+
+    Uma única medida por algoritmo mistura o tempo da ordenação com o ruído da máquina
+    (frequência da CPU, outras tarefas, cache de páginas frio); a mediana de várias
+    repetições após o aquecimento é muito mais estável.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "contadores.h"
+
+#define CABECALHO_ESTATISTICAS "Tamanho,Repeticoes,Tempo,TempoMin,TempoP90,TempoDesvio,TempoES,ElementosPorSegundo," \
+                               CABECALHO_CONTADORES
+#define CABECALHO_CSV_GERAL "Algoritmo,Distribuicao,Threads," CABECALHO_ESTATISTICAS ",CPU,Nucleos"
+
+/*
+    CABECALHO_ESTATISTICAS: colunas escritas por EscreverEstatisticas.
+        - Tempo e TempoES são as medianas das repetições (o CSV continua com uma linha por
+          algoritmo, tamanho e distribuição); TempoMin, TempoP90 e TempoDesvio se referem a Tempo
+    CABECALHO_CSV_GERAL: cabeçalho do CSV geral (results/tempos.csv).
+*/
+
+// ============================================================
+//                  Configuração da medição
+// ============================================================
+/*
+    Estrutura ConfigMedicao: configuração das medições dos Exec*.
+
+    Campos:
+        - repeticoes: execuções medidas de cada arquivo
+        - aquecimento: execuções de cada arquivo antes das medidas, descartadas
+        - fixar_threads: fixa cada thread das ordenações em um núcleo (FixarThread)
+        - restaurar: devolve o arquivo ao conteúdo original antes de uma nova execução;
+          sem ela (NULL), cada arquivo é executado uma única vez, já que a segunda execução
+          ordenaria um arquivo já ordenado
+        - buffers_pipeline: número de buffers do pipeline de E/S (pipeline_es.h); 0 mantém a
+          ordenação dos arquivos mapeados, um de cada vez
+ */
+struct ConfigMedicao {
+    int repeticoes;
+    int aquecimento;
+    bool fixar_threads;
+    bool (*restaurar)(const char *entrada);
+    int buffers_pipeline;
+};
+
+static ConfigMedicao config_medicao = {1, 0, false, NULL, 0};
+
+/*
+    RepeticoesPorArquivo: número de execuções medidas de cada arquivo, ou 1 se não houver
+    como restaurar a entrada.
+ */
+static inline int RepeticoesPorArquivo()
+{
+    return config_medicao.restaurar ? config_medicao.repeticoes : 1;
+}
+
+/*
+    ExecucoesPorArquivo: número total de execuções de cada arquivo (aquecimento + repetições),
+    ou 1 se não houver como restaurar a entrada.
+ */
+static inline int ExecucoesPorArquivo()
+{
+    return config_medicao.restaurar ? config_medicao.aquecimento + config_medicao.repeticoes : 1;
+}
+
+/*
+    ExecucaoRegistrada: verdadeiro se a execução 'execucao' (0, 1, ...) é medida, e não
+    de aquecimento (as de aquecimento vêm primeiro).
+ */
+static inline bool ExecucaoRegistrada(int execucao)
+{
+    return execucao >= ExecucoesPorArquivo() - RepeticoesPorArquivo();
+}
+
+// ============================================================
+//                  ESTATÍSTICAS DOS TEMPOS
+// ============================================================
+/*
+    Estrutura EstatisticasTempo: resumo dos tempos das repetições.
+
+    Campos:
+        - amostras: número de repetições
+        - minimo, mediana, p90: mínimo, mediana e percentil 90 (posto mais próximo)
+        - media, desvio: média e desvio padrão amostral (0 com uma repetição)
+ */
+struct EstatisticasTempo {
+    int amostras;
+    double minimo;
+    double mediana;
+    double p90;
+    double media;
+    double desvio;
+};
+
+/*
+    CalcularEstatisticas: calcula as estatísticas de 'tempos' (o vetor é ordenado no lugar).
+ */
+void CalcularEstatisticas(double *tempos, int n, EstatisticasTempo *estatisticas)
+{
+    estatisticas->amostras = n;
+    if (n <= 0)
+    {
+        estatisticas->minimo = estatisticas->mediana = estatisticas->p90 = 0;
+        estatisticas->media = estatisticas->desvio = 0;
+        return;
+    }
+
+    // Ordenação por inserção: são poucas repetições
+    for (int i = 1; i < n; i++)
+    {
+        double valor = tempos[i];
+        int j = i - 1;
+        while (j >= 0 && tempos[j] > valor)
+        {
+            tempos[j + 1] = tempos[j];
+            j--;
+        }
+        tempos[j + 1] = valor;
+    }
+
+    double soma = 0;
+    for (int i = 0; i < n; i++)
+    {
+        soma += tempos[i];
+    }
+    double media = soma / n;
+
+    double soma_quadrados = 0;
+    for (int i = 0; i < n; i++)
+    {
+        soma_quadrados += (tempos[i] - media) * (tempos[i] - media);
+    }
+
+    int posto_p90 = (int)ceil(0.9 * n) - 1;
+
+    estatisticas->minimo = tempos[0];
+    estatisticas->mediana = (n % 2) ? tempos[n / 2] : (tempos[n / 2 - 1] + tempos[n / 2]) / 2;
+    estatisticas->p90 = tempos[posto_p90 < 0 ? 0 : posto_p90];
+    estatisticas->media = media;
+    estatisticas->desvio = n > 1 ? sqrt(soma_quadrados / (n - 1)) : 0;
+}
+
+/*
+    EscreverEstatisticas: escreve as colunas de CABECALHO_ESTATISTICAS (sem quebra de linha).
+
+    Parâmetros:
+        - csv: arquivo de saída
+        - tamanho: número de elementos ordenados
+        - tempo: estatísticas do tempo de ordenação
+        - tempo_es: estatísticas do tempo de E/S (apenas a mediana é escrita)
+        - contadores: mediana dos contadores de desempenho da ordenação (NULL: colunas vazias)
+ */
+void EscreverEstatisticas(FILE *csv, long tamanho, const EstatisticasTempo *tempo, const EstatisticasTempo *tempo_es,
+                          const LeituraContadores *contadores)
+{
+    double vazao = tempo->mediana > 0 ? tamanho / tempo->mediana : 0;
+    fprintf(csv, "%ld,%d,%f,%f,%f,%f,%f,%.0f", tamanho, tempo->amostras, tempo->mediana, tempo->minimo,
+            tempo->p90, tempo->desvio, tempo_es->mediana, vazao);
+    EscreverContadores(csv, contadores);
+}
+
+/*
+    ImprimirEstatisticas: imprime o resultado de um arquivo no formato dos Exec*.
+ */
+void ImprimirEstatisticas(const char *nome, const char *entrada, const char *distribuicao,
+                          const EstatisticasTempo *tempo, const EstatisticasTempo *tempo_es)
+{
+    if (tempo->amostras == 1)
+    {
+        printf("%s - Tempo para ordenar %s (%s): %f s (E/S: %f s)\n", nome, entrada, distribuicao,
+               tempo->mediana, tempo_es->mediana);
+        return;
+    }
+
+    printf("%s - Tempo para ordenar %s (%s): mediana %f s, mín %f s, p90 %f s, desvio %f s em %d repetições (E/S: %f s)\n",
+           nome, entrada, distribuicao, tempo->mediana, tempo->minimo, tempo->p90, tempo->desvio,
+           tempo->amostras, tempo_es->mediana);
+}
+
+// ============================================================
+//                  INFORMAÇÕES DO SISTEMA
+// ============================================================
+/*
+    ModeloCPU: modelo da CPU (campo "model name" de /proc/cpuinfo), sem vírgulas, para as
+    colunas do CSV; "desconhecido" se não estiver disponível.
+ */
+const char *ModeloCPU()
+{
+    static char modelo[256] = "";
+    if (modelo[0] != '\0')
+    {
+        return modelo;
+    }
+
+    strcpy(modelo, "desconhecido");
+
+    FILE *cpuinfo = fopen("/proc/cpuinfo", "r");
+    if (!cpuinfo)
+    {
+        return modelo;
+    }
+
+    char linha[512];
+    while (fgets(linha, sizeof(linha), cpuinfo))
+    {
+        if (strncmp(linha, "model name", 10) != 0)
+            continue;
+
+        char *valor = strchr(linha, ':');
+        if (!valor)
+            continue;
+        valor++;
+        while (*valor == ' ' || *valor == '\t')
+            valor++;
+
+        snprintf(modelo, sizeof(modelo), "%s", valor);
+        for (char *c = modelo; *c; c++)
+        {
+            if (*c == ',' || *c == '\n')
+                *c = (*c == ',') ? ' ' : '\0';
+        }
+        break;
+    }
+
+    fclose(cpuinfo);
+    return modelo;
+}
+
+/*
+    NucleosDisponiveis: número de processadores lógicos disponíveis.
+ */
+long NucleosDisponiveis()
+{
+    return sysconf(_SC_NPROCESSORS_ONLN);
+}
+
+// ============================================================
+//                  FIXAÇÃO DAS THREADS
+// ============================================================
+/*
+    NucleosPermitidos: núcleos permitidos ao processo (sched_getaffinity), lidos uma única vez,
+    antes que alguma thread seja fixada; respeitam por exemplo um taskset externo. Retorna o
+    número de núcleos (0 se não for possível lê-los).
+ */
+int NucleosPermitidos(const cpu_set_t **mascara, const int **nucleos)
+{
+    static cpu_set_t permitidos;
+    static int lista[CPU_SETSIZE];
+    static int num_nucleos = -1;
+
+    if (num_nucleos < 0)
+    {
+        num_nucleos = 0;
+        CPU_ZERO(&permitidos);
+        if (sched_getaffinity(0, sizeof(permitidos), &permitidos) == 0)
+        {
+            for (int c = 0; c < CPU_SETSIZE; c++)
+            {
+                if (CPU_ISSET(c, &permitidos))
+                    lista[num_nucleos++] = c;
+            }
+        }
+    }
+
+    *mascara = &permitidos;
+    *nucleos = lista;
+    return num_nucleos;
+}
+
+/*
+    FixarThread: se config_medicao.fixar_threads estiver ativo, fixa a thread no núcleo de
+    índice 'indice' (módulo o número de núcleos permitidos ao processo).
+
+    Funcionamento:
+        - São fixadas apenas as threads que ordenam: as dos pools e do radix com threads, e a
+          thread principal durante a região medida (LiberarThread a devolve depois). As
+          threads criadas por uma thread fixada herdam o seu núcleo, então a geração, a
+          verificação e as threads de E/S do pipeline são criadas com a thread principal livre
+        - Sem fixação o escalonador pode migrar as threads entre núcleos durante a medição,
+          perdendo o conteúdo das caches e aumentando a variação dos tempos
+ */
+void FixarThread(pthread_t thread, int indice)
+{
+    if (!config_medicao.fixar_threads)
+    {
+        return;
+    }
+
+    const cpu_set_t *permitidos;
+    const int *nucleos;
+    int num_nucleos = NucleosPermitidos(&permitidos, &nucleos);
+    if (num_nucleos == 0)
+    {
+        return;
+    }
+
+    cpu_set_t conjunto;
+    CPU_ZERO(&conjunto);
+    CPU_SET(nucleos[indice % num_nucleos], &conjunto);
+    if (pthread_setaffinity_np(thread, sizeof(conjunto), &conjunto) != 0)
+    {
+        fprintf(stderr, "Aviso: não foi possível fixar a thread %d\n", indice);
+    }
+}
+
+/*
+    LiberarThread: devolve a thread fixada com FixarThread a todos os núcleos permitidos ao
+    processo.
+ */
+void LiberarThread(pthread_t thread)
+{
+    if (!config_medicao.fixar_threads)
+    {
+        return;
+    }
+
+    const cpu_set_t *permitidos;
+    const int *nucleos;
+    if (NucleosPermitidos(&permitidos, &nucleos) > 0)
+    {
+        pthread_setaffinity_np(thread, sizeof(cpu_set_t), permitidos);
+    }
+}
+
+// ============================================================
+//                  REGISTRO DAS MEDIÇÕES
+// ============================================================
+/*
+    RegistrarMedicoes: resume as medidas das repetições de um arquivo, imprime o resultado e o
+    grava no CSV geral e no CSV do algoritmo.
+
+    Parâmetros:
+        - csv, algoritmo_csv: CSV geral (CABECALHO_CSV_GERAL) e CSV do algoritmo
+        - nome, entrada, distribuicao, num_threads: identificação da linha
+        - tamanho: número de elementos do arquivo
+        - tempos, tempos_es, leituras: medidas das 'medidas' repetições (os tempos são ordenados)
+        - colunas_extras: colunas próprias do CSV do algoritmo, separadas por vírgula, gravadas
+          após as estatísticas (NULL se não houver)
+ */
+void RegistrarMedicoes(FILE *csv, FILE *algoritmo_csv, const char *nome, const char *entrada,
+                       const char *distribuicao, int num_threads, long tamanho, double *tempos,
+                       double *tempos_es, const LeituraContadores *leituras, int medidas,
+                       const char *colunas_extras = NULL)
+{
+    EstatisticasTempo tempo, tempo_es;
+    CalcularEstatisticas(tempos, medidas, &tempo);
+    CalcularEstatisticas(tempos_es, medidas, &tempo_es);
+    LeituraContadores contadores;
+    MedianaContadores(leituras, medidas, &contadores);
+
+    ImprimirEstatisticas(nome, entrada, distribuicao, &tempo, &tempo_es);
+    ImprimirContadores(&contadores, tamanho);
+
+    fprintf(csv, "%s,%s,%d,", nome, distribuicao, num_threads);
+    EscreverEstatisticas(csv, tamanho, &tempo, &tempo_es, &contadores);
+    fprintf(csv, ",%s,%ld\n", ModeloCPU(), NucleosDisponiveis());
+
+    fprintf(algoritmo_csv, "%s,%d,", distribuicao, num_threads);
+    EscreverEstatisticas(algoritmo_csv, tamanho, &tempo, &tempo_es, &contadores);
+    if (colunas_extras)
+    {
+        fprintf(algoritmo_csv, ",%s", colunas_extras);
+    }
+    fprintf(algoritmo_csv, "\n");
+}
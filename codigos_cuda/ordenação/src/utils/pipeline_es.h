@@ -0,0 +1,460 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa o pipeline de E/S dos arquivos de entrada, usado pelas funções
+    Exec* no lugar do mapeamento quando config_medicao.buffers_pipeline > 0 (opção --buffers).
+    O fluxo geral é:
+        1. Uma thread de leitura lê o arquivo i + 1 (pread) em um buffer livre enquanto a
+           thread principal ordena o arquivo i
+        2. Uma thread de escrita grava o arquivo i - 1 (pwrite) de volta no próprio arquivo
+           enquanto a thread principal ordena o arquivo i
+        3. Com B buffers (o arquivo i usa o buffer i % B), a leitura só começa quando o buffer
+           já foi gravado: B = 1 não sobrepõe nada, B = 2 sobrepõe a leitura ou a escrita com
+           a ordenação e B = 3 sobrepõe as três etapas
+        4. Além dos tempos de cada arquivo (CSV geral e do algoritmo, como no
+           ExecOrdenacaoMapeada), registra o tempo total do lote em CSV_PIPELINE
+
+    No ExecOrdenacaoMapeada a leitura e a escrita de cada arquivo acontecem antes e depois da
+    ordenação, e o tempo total do lote é a soma das três etapas; com o pipeline ele se
+    aproxima do maior entre o tempo de ordenação e o de E/S.
+    A memória usada é B vezes o tamanho do maior arquivo.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#include "medicao.h"
+
+#define MAX_BUFFERS_PIPELINE 3
+#define CSV_PIPELINE "results/pipeline.csv"
+#define CABECALHO_CSV_PIPELINE "Algoritmo,Distribuicao,Threads,Buffers,Arquivos,Elementos,TempoTotal," \
+                               "TempoOrdenacao,TempoES,ElementosPorSegundo"
+
+/*
+    MAX_BUFFERS_PIPELINE: com 3 buffers leitura, ordenação e escrita já acontecem ao mesmo
+        tempo; mais buffers só adiantariam a leitura.
+    CSV_PIPELINE: CSV com o tempo total de cada lote (CABECALHO_CSV_PIPELINE), criado pelo main.
+        - TempoTotal: mediana das repetições, da primeira leitura até a última escrita
+        - TempoOrdenacao, TempoES: somas das medianas dos arquivos do lote
+        - ElementosPorSegundo: Elementos / TempoTotal (vazão de ponta a ponta)
+*/
+
+// ============================================================
+//                  Estrutura do pipeline
+// ============================================================
+/*
+    Estrutura PipelineES: estado compartilhado pelas três threads durante uma execução do lote.
+
+    Campos:
+        - entradas, num_entradas: arquivos do lote
+        - num_buffers: número de buffers (1 a MAX_BUFFERS_PIPELINE)
+        - buffers: buffers do tamanho do maior arquivo
+        - bytes: tamanho lido de cada arquivo
+        - ok: verdadeiro se o arquivo foi lido; senão a ordenação e a escrita o ignoram
+        - tempo_leitura, tempo_escrita: duração da leitura e da escrita de cada arquivo
+        - lidos, ordenados, escritos: arquivos que já terminaram cada etapa
+        - mutex, condicao: protegem e sinalizam os três contadores de etapas
+ */
+struct PipelineES {
+    const char **entradas;
+    int num_entradas;
+    int num_buffers;
+    char *buffers[MAX_BUFFERS_PIPELINE];
+    size_t *bytes;
+    bool *ok;
+    double *tempo_leitura;
+    double *tempo_escrita;
+    int lidos;
+    int ordenados;
+    int escritos;
+    pthread_mutex_t mutex;
+    pthread_cond_t condicao;
+};
+
+/*
+    EsperarEtapa: bloqueia até que *contador seja maior que 'minimo' e retorna.
+ */
+static void EsperarEtapa(PipelineES *pipeline, const int *contador, int minimo)
+{
+    pthread_mutex_lock(&pipeline->mutex);
+    while (*contador <= minimo)
+    {
+        pthread_cond_wait(&pipeline->condicao, &pipeline->mutex);
+    }
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+/*
+    ConcluirEtapa: marca o arquivo i como concluído na etapa de *contador e acorda as demais
+    threads.
+ */
+static void ConcluirEtapa(PipelineES *pipeline, int *contador, int i)
+{
+    pthread_mutex_lock(&pipeline->mutex);
+    *contador = i + 1;
+    pthread_cond_broadcast(&pipeline->condicao);
+    pthread_mutex_unlock(&pipeline->mutex);
+}
+
+// ============================================================
+//                  LEITURA E ESCRITA DOS ARQUIVOS
+// ============================================================
+/*
+    LerArquivoBuffer: lê o arquivo 'caminho' inteiro em 'buffer', de no máximo 'capacidade' bytes.
+
+    Retorno:
+        - true em caso de sucesso; em caso de erro imprime a mensagem (perror) e retorna false
+
+    Funcionamento:
+        - POSIX_FADV_SEQUENTIAL pede ao kernel uma leitura antecipada maior
+        - pread em laço, pois uma chamada pode ler menos que o pedido
+ */
+bool LerArquivoBuffer(const char *caminho, char *buffer, size_t capacidade, size_t *bytes)
+{
+    *bytes = 0;
+    int fd = open(caminho, O_RDONLY);
+    if (fd < 0)
+    {
+        perror("Erro ao abrir arquivo de entrada");
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size > capacidade)
+    {
+        fprintf(stderr, "Erro: tamanho inválido de %s\n", caminho);
+        close(fd);
+        return false;
+    }
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    size_t lidos = 0;
+    while (lidos < (size_t)info.st_size)
+    {
+        ssize_t n = pread(fd, buffer + lidos, (size_t)info.st_size - lidos, (off_t)lidos);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+        {
+            perror("Erro ao ler arquivo de entrada");
+            close(fd);
+            return false;
+        }
+        lidos += (size_t)n;
+    }
+
+    close(fd);
+    *bytes = lidos;
+    return true;
+}
+
+/*
+    EscreverBufferArquivo: grava 'bytes' bytes de 'buffer' no início do arquivo 'caminho',
+    com pwrite em laço. Em caso de erro imprime a mensagem (perror) e retorna false.
+ */
+bool EscreverBufferArquivo(const char *caminho, const char *buffer, size_t bytes)
+{
+    int fd = open(caminho, O_WRONLY);
+    if (fd < 0)
+    {
+        perror("Erro ao abrir arquivo de saída");
+        return false;
+    }
+
+    size_t escritos = 0;
+    while (escritos < bytes)
+    {
+        ssize_t n = pwrite(fd, buffer + escritos, bytes - escritos, (off_t)escritos);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+        {
+            perror("Erro ao escrever arquivo de saída");
+            close(fd);
+            return false;
+        }
+        escritos += (size_t)n;
+    }
+
+    close(fd);
+    return true;
+}
+
+// ============================================================
+//                  THREADS DE LEITURA E ESCRITA
+// ============================================================
+/*
+    ThreadLeituraPipeline: lê os arquivos em ordem; o arquivo i espera a escrita do arquivo
+    i - num_buffers, que usava o mesmo buffer.
+ */
+void *ThreadLeituraPipeline(void *arg)
+{
+    PipelineES *pipeline = (PipelineES *)arg;
+    size_t capacidade = pipeline->bytes[pipeline->num_entradas];
+
+    for (int i = 0; i < pipeline->num_entradas; i++)
+    {
+        EsperarEtapa(pipeline, &pipeline->escritos, i - pipeline->num_buffers);
+
+        auto inicio = std::chrono::high_resolution_clock::now();
+        pipeline->ok[i] = LerArquivoBuffer(pipeline->entradas[i], pipeline->buffers[i % pipeline->num_buffers],
+                                           capacidade, &pipeline->bytes[i]);
+        auto fim = std::chrono::high_resolution_clock::now();
+        pipeline->tempo_leitura[i] = std::chrono::duration<double>(fim - inicio).count();
+
+        ConcluirEtapa(pipeline, &pipeline->lidos, i);
+    }
+    return NULL;
+}
+
+/*
+    ThreadEscritaPipeline: grava os arquivos em ordem, cada um assim que é ordenado.
+ */
+void *ThreadEscritaPipeline(void *arg)
+{
+    PipelineES *pipeline = (PipelineES *)arg;
+
+    for (int i = 0; i < pipeline->num_entradas; i++)
+    {
+        EsperarEtapa(pipeline, &pipeline->ordenados, i);
+
+        auto inicio = std::chrono::high_resolution_clock::now();
+        if (pipeline->ok[i])
+        {
+            pipeline->ok[i] = EscreverBufferArquivo(pipeline->entradas[i], pipeline->buffers[i % pipeline->num_buffers],
+                                                    pipeline->bytes[i]);
+        }
+        auto fim = std::chrono::high_resolution_clock::now();
+        pipeline->tempo_escrita[i] = std::chrono::duration<double>(fim - inicio).count();
+
+        ConcluirEtapa(pipeline, &pipeline->escritos, i);
+    }
+    return NULL;
+}
+
+// ============================================================
+//             FUNÇÃO DE EXECUÇÃO E MEDIÇÃO DE TEMPO
+// ============================================================
+/*
+    ExecOrdenacaoPipeline: mesmo resultado do ExecOrdenacaoMapeada (arquivo_mapeado.h), lendo,
+    ordenando e gravando os arquivos em um pipeline com config_medicao.buffers_pipeline buffers.
+
+    Parâmetros:
+        - entradas, num_entradas, csv_saida, distribuicao, csv_algoritmo, nome, num_threads,
+          ordenar, contexto: como no ExecOrdenacaoMapeada
+
+    Funcionamento:
+        - Aloca os buffers uma única vez, do tamanho do maior arquivo
+        * ExecucoesPorArquivo() vezes, restaurando todas as entradas a partir da segunda:
+        - Cria as threads de leitura e de escrita, livres de fixação; a thread principal ordena
+          cada arquivo assim que é lido, medindo apenas a ordenação (e os contadores de
+          desempenho), e só fica fixada (FixarThread) durante a ordenação
+        - TempoES de cada arquivo soma a leitura e a escrita, que acontecem em paralelo com a
+          ordenação dos outros arquivos; o tempo total vai da criação das threads até a última
+          escrita
+        * Registra as estatísticas de cada arquivo (RegistrarMedicoes) e a linha do lote em
+          CSV_PIPELINE
+        - As threads de E/S herdam os contadores de desempenho, que passam a incluir o que elas
+          executam em modo usuário durante a ordenação (as cópias do pread e do pwrite são
+          feitas no kernel e ficam de fora)
+ */
+template <typename T>
+void ExecOrdenacaoPipeline(const char **entradas, int num_entradas, const char *csv_saida,
+                           const char *distribuicao, const char *csv_algoritmo, const char *nome,
+                           int num_threads, void (*ordenar)(T *vetor, long tamanho, void *contexto),
+                           void *contexto)
+{
+    FILE *csv = fopen(csv_saida, "a");
+    FILE *algoritmo_csv = fopen(csv_algoritmo, "a");
+    FILE *pipeline_csv = fopen(CSV_PIPELINE, "a");
+    if (!csv || !algoritmo_csv || !pipeline_csv)
+    {
+        perror("Erro ao abrir arquivos de saída CSV");
+        if (csv)
+            fclose(csv);
+        if (algoritmo_csv)
+            fclose(algoritmo_csv);
+        if (pipeline_csv)
+            fclose(pipeline_csv);
+        return;
+    }
+
+    fprintf(algoritmo_csv, "Distribuicao,Threads," CABECALHO_ESTATISTICAS "\n");
+
+    PipelineES pipeline;
+    pipeline.entradas = entradas;
+    pipeline.num_entradas = num_entradas;
+    pipeline.num_buffers = config_medicao.buffers_pipeline;
+    if (pipeline.num_buffers > MAX_BUFFERS_PIPELINE)
+        pipeline.num_buffers = MAX_BUFFERS_PIPELINE;
+    pipeline.bytes = new size_t[num_entradas + 1];  // a última posição guarda a capacidade
+    pipeline.ok = new bool[num_entradas];
+    pipeline.tempo_leitura = new double[num_entradas];
+    pipeline.tempo_escrita = new double[num_entradas];
+    pthread_mutex_init(&pipeline.mutex, NULL);
+    pthread_cond_init(&pipeline.condicao, NULL);
+
+    // Buffers do tamanho do maior arquivo, alinhados à linha de cache
+    size_t capacidade = sizeof(T);
+    for (int i = 0; i < num_entradas; i++)
+    {
+        struct stat info;
+        if (stat(entradas[i], &info) == 0 && (size_t)info.st_size > capacidade)
+            capacidade = (size_t)info.st_size;
+    }
+    pipeline.bytes[num_entradas] = capacidade;
+
+    bool alocado = true;
+    for (int b = 0; b < MAX_BUFFERS_PIPELINE; b++)
+    {
+        pipeline.buffers[b] = NULL;
+        if (b < pipeline.num_buffers && posix_memalign((void **)&pipeline.buffers[b], 64, capacidade) != 0)
+        {
+            pipeline.buffers[b] = NULL;
+            alocado = false;
+        }
+    }
+
+    int execucoes = ExecucoesPorArquivo();
+    double *tempos = new double[(long)num_entradas * execucoes];
+    double *tempos_es = new double[(long)num_entradas * execucoes];
+    LeituraContadores *leituras = new LeituraContadores[(long)num_entradas * execucoes];
+    int *medidas = new int[num_entradas]();
+    double *tempos_total = new double[execucoes];
+    int medidas_total = 0;
+
+    for (int execucao = 0; alocado && execucao < execucoes; execucao++)
+    {
+        bool restaurado = true;
+        for (int i = 0; execucao > 0 && i < num_entradas; i++)
+        {
+            restaurado = restaurado && config_medicao.restaurar(entradas[i]);
+        }
+        if (!restaurado)
+        {
+            break;
+        }
+
+        pipeline.lidos = pipeline.ordenados = pipeline.escritos = 0;
+
+        auto inicio_total = std::chrono::high_resolution_clock::now();
+        pthread_t leitora, escritora;
+        pthread_create(&leitora, NULL, ThreadLeituraPipeline, &pipeline);
+        pthread_create(&escritora, NULL, ThreadEscritaPipeline, &pipeline);
+
+        for (int i = 0; i < num_entradas; i++)
+        {
+            EsperarEtapa(&pipeline, &pipeline.lidos, i);
+
+            double tempo = 0.0;
+            LeituraContadores leitura;
+            long tamanho = (long)(pipeline.bytes[i] / sizeof(T));
+            if (pipeline.ok[i])
+            {
+                FixarThread(pthread_self(), 0);
+                IniciarContadores();
+                auto inicio = std::chrono::high_resolution_clock::now();
+                if (tamanho > 0)
+                {
+                    ordenar((T *)pipeline.buffers[i % pipeline.num_buffers], tamanho, contexto);
+                }
+                auto fim = std::chrono::high_resolution_clock::now();
+                PararContadores(&leitura);
+                LiberarThread(pthread_self());
+                tempo = std::chrono::duration<double>(fim - inicio).count();
+            }
+
+            // Registra antes de liberar o arquivo para a escrita, que pode alterar ok[i]
+            if (pipeline.ok[i] && ExecucaoRegistrada(execucao))
+            {
+                long posicao = (long)i * execucoes + medidas[i];
+                tempos[posicao] = tempo;
+                leituras[posicao] = leitura;
+            }
+
+            ConcluirEtapa(&pipeline, &pipeline.ordenados, i);
+        }
+
+        pthread_join(leitora, NULL);
+        pthread_join(escritora, NULL);
+        auto fim_total = std::chrono::high_resolution_clock::now();
+
+        if (ExecucaoRegistrada(execucao))
+        {
+            for (int i = 0; i < num_entradas; i++)
+            {
+                if (pipeline.ok[i])
+                {
+                    tempos_es[(long)i * execucoes + medidas[i]] = pipeline.tempo_leitura[i] + pipeline.tempo_escrita[i];
+                    medidas[i]++;
+                }
+            }
+            tempos_total[medidas_total++] = std::chrono::duration<double>(fim_total - inicio_total).count();
+        }
+    }
+
+    long elementos = 0;
+    double soma_ordenacao = 0.0, soma_es = 0.0;
+    for (int i = 0; i < num_entradas; i++)
+    {
+        if (medidas[i] == 0)
+        {
+            continue;
+        }
+
+        long tamanho = (long)(pipeline.bytes[i] / sizeof(T));
+        long posicao = (long)i * execucoes;
+        RegistrarMedicoes(csv, algoritmo_csv, nome, entradas[i], distribuicao, num_threads, tamanho,
+                          tempos + posicao, tempos_es + posicao, leituras + posicao, medidas[i]);
+
+        // RegistrarMedicoes ordena os tempos: a mediana fica no meio
+        elementos += tamanho;
+        soma_ordenacao += (tempos[posicao + (medidas[i] - 1) / 2] + tempos[posicao + medidas[i] / 2]) / 2.0;
+        soma_es += (tempos_es[posicao + (medidas[i] - 1) / 2] + tempos_es[posicao + medidas[i] / 2]) / 2.0;
+    }
+
+    if (medidas_total > 0)
+    {
+        EstatisticasTempo total;
+        CalcularEstatisticas(tempos_total, medidas_total, &total);
+        double vazao = total.mediana > 0.0 ? (double)elementos / total.mediana : 0.0;
+
+        printf("%s - Pipeline com %d buffers: %d arquivos, %ld elementos em %f s (ordenação %f s, E/S %f s), %.0f elementos/s\n",
+               nome, pipeline.num_buffers, num_entradas, elementos, total.mediana, soma_ordenacao, soma_es, vazao);
+        fprintf(pipeline_csv, "%s,%s,%d,%d,%d,%ld,%f,%f,%f,%.0f\n", nome, distribuicao, num_threads,
+                pipeline.num_buffers, num_entradas, elementos, total.mediana, soma_ordenacao, soma_es, vazao);
+    }
+    else if (!alocado)
+    {
+        fprintf(stderr, "Erro: memória insuficiente para %d buffers de %zu bytes\n", pipeline.num_buffers, capacidade);
+    }
+
+    for (int b = 0; b < MAX_BUFFERS_PIPELINE; b++)
+    {
+        free(pipeline.buffers[b]);
+    }
+    pthread_mutex_destroy(&pipeline.mutex);
+    pthread_cond_destroy(&pipeline.condicao);
+    delete[] pipeline.bytes;
+    delete[] pipeline.ok;
+    delete[] pipeline.tempo_leitura;
+    delete[] pipeline.tempo_escrita;
+    delete[] tempos;
+    delete[] tempos_es;
+    delete[] leituras;
+    delete[] medidas;
+    delete[] tempos_total;
+    fclose(csv);
+    fclose(algoritmo_csv);
+    fclose(pipeline_csv);
+}
@@ -0,0 +1,193 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo define os registros (chave + carga) ordenados pelas variantes chave-valor do
+    Merge Sort e do Radix Sort, e o argsort.
+    O fluxo geral é:
+        1. GerarArquivosRegistros (utils.h) grava arquivos de registros com chaves na
+           distribuição DIST_REGISTROS e a carga de cada registro criada a partir da sua linha
+           (posição original)
+        2. As ordenações movem a carga junto com a chave, no layout do arquivo:
+            - AoS (array of structs): um vetor de Registro, chave e carga lado a lado
+            - SoA (struct of arrays): o vetor das n chaves seguido do vetor das n cargas
+        3. O argsort não move as chaves: recebe as n chaves seguidas de espaço para n índices
+           (uint32_t) e grava a permutação que as ordena
+        4. VerificarRegistros e VerificarArgsort (verificador.h) conferem a ordem, a
+           estabilidade (chaves iguais mantêm a ordem das linhas) e a integridade das cargas
+
+    Em um banco de dados a ordenação raramente é de inteiros soltos: são registros ordenados
+    por uma chave, ou pares (chave, linha) cuja permutação é aplicada depois à tabela. O layout
+    define o tráfego de memória: no AoS cada passada move o registro inteiro, no SoA as chaves
+    podem ser lidas sem as cargas.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "distribuicoes.h"
+
+#define DIST_REGISTROS DIST_ZIPF
+
+/*
+    DIST_REGISTROS: distribuição das chaves dos registros. A zipf tem chaves muito repetidas
+    (o que exercita a estabilidade) e também muitas chaves distintas. As chaves são as mesmas
+    do arquivo de int da distribuição; as trocas da quase_ordenada não seriam aplicadas.
+*/
+
+// ============================================================
+//                  REGISTROS E LAYOUTS
+// ============================================================
+/*
+    Estrutura Registro: um registro com chave do tipo K e carga do tipo P.
+        - Os tipos usados não têm bytes de preenchimento (sizeof == sizeof(K) + sizeof(P)),
+          o que permite comparar e calcular o hash dos registros byte a byte, e mapear o
+          arquivo SoA com o mesmo número de bytes por elemento
+ */
+template <typename K, typename P>
+struct Registro {
+    K chave;
+    P carga;
+};
+
+/*
+    Enum LayoutRegistros: disposição dos registros no arquivo e na memória.
+ */
+enum LayoutRegistros {
+    LAYOUT_AOS,
+    LAYOUT_SOA
+};
+
+/*
+    NomeLayout: nome do layout, usado no nome dos algoritmos e dos CSVs.
+ */
+const char *NomeLayout(LayoutRegistros layout)
+{
+    return layout == LAYOUT_AOS ? "aos" : "soa";
+}
+
+/*
+    VetoresSoA: separa um arquivo SoA com 'n' registros no vetor das chaves e no das cargas.
+        - O arquivo é mapeado como um vetor de Registro<K, P> apenas para ter o tamanho certo
+          (n * (sizeof(K) + sizeof(P)) bytes); as cargas começam após as n chaves
+ */
+template <typename K, typename P>
+void VetoresSoA(void *arquivo, long n, K **chaves, P **cargas)
+{
+    static_assert(sizeof(Registro<K, P>) == sizeof(K) + sizeof(P), "registro com bytes de preenchimento");
+    static_assert(alignof(P) <= alignof(K), "as cargas devem ficar alinhadas após as chaves");
+
+    *chaves = (K *)arquivo;
+    *cargas = (P *)((char *)arquivo + n * sizeof(K));
+}
+
+// ============================================================
+//                  TIPOS DE CARGA
+// ============================================================
+/*
+    CargaLarga: carga de 12 bytes (registro de 16 bytes com chave int), representando uma
+    linha mais larga da tabela.
+        - linha: posição original do registro
+        - dados: valores derivados da linha (MisturarSplitMix64), alterados se a carga for
+          corrompida ou trocada com a de outro registro
+ */
+struct CargaLarga {
+    uint32_t linha;
+    uint32_t dados[2];
+};
+
+/*
+    CargaRegistro<P>: operações sobre a carga do tipo P.
+
+    Funcionamento:
+        - Nome: nome usado no nome dos algoritmos e dos CSVs
+        - Criar: carga do registro gerado na posição 'linha'
+        - Linha: posição original do registro, usada para conferir a estabilidade
+ */
+template <typename P> struct CargaRegistro;
+
+template <> struct CargaRegistro<uint32_t>
+{
+    static const char *Nome() { return "par"; }
+    static uint32_t Criar(long linha) { return (uint32_t)linha; }
+    static uint32_t Linha(const uint32_t &carga) { return carga; }
+};
+
+template <> struct CargaRegistro<CargaLarga>
+{
+    static const char *Nome() { return "largo"; }
+    static CargaLarga Criar(long linha)
+    {
+        CargaLarga carga;
+        uint64_t mistura = MisturarSplitMix64((uint64_t)linha);
+        carga.linha = (uint32_t)linha;
+        carga.dados[0] = (uint32_t)mistura;
+        carga.dados[1] = (uint32_t)(mistura >> 32);
+        return carga;
+    }
+    static uint32_t Linha(const CargaLarga &carga) { return carga.linha; }
+};
+
+// ============================================================
+//                  ENTRADAS DO ARGSORT
+// ============================================================
+/*
+    EntradasArgsortValidas: copia para 'validas' as entradas de argsort com no máximo
+    UINT32_MAX chaves, o limite dos índices uint32_t.
+
+    Retorno:
+        - o número de entradas copiadas; as demais são descartadas com uma mensagem de erro,
+          antes de qualquer medição, para que nenhum tempo seja registrado sem a permutação
+ */
+int EntradasArgsortValidas(const char **entradas, int num_entradas, const char **validas)
+{
+    int num_validas = 0;
+    for (int i = 0; i < num_entradas; i++)
+    {
+        struct stat info;
+        long chaves = stat(entradas[i], &info) == 0 ? (long)(info.st_size / sizeof(Registro<int, uint32_t>)) : 0;
+        if (chaves > (long)UINT32_MAX)
+        {
+            fprintf(stderr, "Erro: %s tem %ld chaves; o argsort aceita no máximo %u\n", entradas[i], chaves,
+                    UINT32_MAX);
+            continue;
+        }
+        validas[num_validas++] = entradas[i];
+    }
+    return num_validas;
+}
+
+// ============================================================
+//                  GERADORES DOS REGISTROS
+// ============================================================
+/*
+    Estrutura GeradorRegistro: gerador (PreencherParalelo) dos registros de um arquivo AoS;
+    a chave vem de 'chaves' e a carga de CargaRegistro<P>::Criar(i).
+ */
+template <typename P>
+struct GeradorRegistro {
+    GeradorDistribuicao chaves;
+
+    Registro<int, P> operator()(long i, uint64_t aleatorio) const
+    {
+        Registro<int, P> registro;
+        registro.chave = chaves(i, aleatorio);
+        registro.carga = CargaRegistro<P>::Criar(i);
+        return registro;
+    }
+};
+
+/*
+    Estrutura GeradorCarga: gerador (PreencherParalelo) do vetor das cargas de um arquivo SoA.
+ */
+template <typename P>
+struct GeradorCarga {
+    P operator()(long i, uint64_t) const
+    {
+        return CargaRegistro<P>::Criar(i);
+    }
+};
@@ -0,0 +1,57 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo define a configuração dos modos de seleção (nth_element, top-k e ordenação
+    parcial), compartilhada pelos seletores e pelo verificador.
+    O fluxo geral é:
+        1. O main define fracao_selecao com a opção --selecao (padrão: 1% dos elementos)
+        2. Os seletores (selecao_seq.h, selecao_threads.h) calculam k com
+           ElementosSelecionados(n) e deixam o arquivo no estado do seu ModoSelecao
+        3. VerificarSelecao (verificador.h) compara o arquivo com uma cópia totalmente
+           ordenada, conferindo o que o modo garante
+
+    Muitas consultas precisam apenas dos k menores elementos ou de um percentil, e não do
+    vetor inteiro ordenado: a seleção é O(n), o top-k com heap O(n log k) e a ordenação
+    parcial O(n + k log k), contra O(n log n) da ordenação completa.
+*/
+
+#pragma once
+
+#include <stdio.h>
+
+#define FRACAO_SELECAO_PADRAO 0.01
+
+/*
+    FRACAO_SELECAO_PADRAO: fração dos elementos selecionados (k = fração * n), 1%.
+*/
+
+/*
+    fracao_selecao: fração usada pelos seletores e pelo verificador (opção --selecao).
+ */
+static double fracao_selecao = FRACAO_SELECAO_PADRAO;
+
+/*
+    Enum ModoSelecao: o que um seletor garante sobre o arquivo, além de manter os elementos.
+        - SELECAO_NTH: vetor[k - 1] é o k-ésimo menor elemento, os anteriores são menores ou
+          iguais a ele e os seguintes maiores ou iguais (como std::nth_element)
+        - SELECAO_PREFIXO: vetor[0..k) são os k menores elementos, em ordem crescente, e os
+          seguintes são maiores ou iguais a eles (top-k e ordenação parcial)
+ */
+enum ModoSelecao {
+    SELECAO_NTH,
+    SELECAO_PREFIXO
+};
+
+/*
+    ElementosSelecionados: k para um vetor de 'n' elementos, entre 1 e n.
+ */
+static inline long ElementosSelecionados(long n)
+{
+    long k = (long)(fracao_selecao * (double)n);
+    if (k < 1)
+        k = 1;
+    if (k > n)
+        k = n;
+    return k;
+}
@@ -1,6 +1,22 @@
 #include <iostream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <type_traits>
+#include <sys/stat.h>
+
+#include "gerador.h"
+#include "distribuicoes.h"
+#include "verificador.h"
+
+#define DIR_CACHE_ENTRADAS "dados/cache"
+
+/*
+    DIR_CACHE_ENTRADAS: diretório onde GerarEntradasCache guarda as entradas originais
+    (ainda não ordenadas), restauradas por RestaurarEntradas antes de cada algoritmo.
+*/
 
 void imprimir_vetor(const char **entrada, int num_entradas)
 {
@@ -41,82 +57,295 @@ void imprimir_vetor(const char **entrada, int num_entradas)
     }
 }
 
-void VerificarOrdenado(const char **arquivos, const int num_entradas)
+/*
+    GerarArquivos: gera arquivos binários de inteiros com a distribuição pedida
+    (por padrão, uniformes entre 0 e 100 milhões).
+
+    Parâmetros:
+        - tamanho_arquivos: número de inteiros de cada arquivo
+        - nomes_arquivos: caminhos dos arquivos a serem gerados
+        - num_arquivos: número de arquivos
+        - distribuicao: distribuição dos valores (ver distribuicoes.h)
+        - semente: semente do gerador; a mesma semente gera sempre os mesmos arquivos
+
+    Funcionamento:
+        - Cada arquivo é gerado em paralelo e gravado por mapeamento em memória
+          (GerarArquivoDistribuicao)
+        - Registra a assinatura de cada arquivo (RegistrarAssinatura), conferida pelo
+          VerificarOrdenado após a ordenação
+ */
+void GerarArquivos(const long *tamanho_arquivos, const char **nomes_arquivos, const int num_arquivos,
+                   Distribuicao distribuicao = DIST_UNIFORME, uint64_t semente = SEMENTE_PADRAO)
 {
-    for (int i = 0; i < num_entradas; i++)
+    for (int i = 0; i < num_arquivos; i++)
     {
-        const char *path = arquivos[i];
-        FILE *file = fopen(path, "rb");
-        if (!file)
+        long n = tamanho_arquivos[i];
+        const char *path = nomes_arquivos[i];
+
+        AssinaturaMulticonjunto assinatura;
+        if (GerarArquivoDistribuicao(path, n, distribuicao, semente, &assinatura))
         {
-            perror(path);
-            continue;
+            RegistrarAssinatura(path, &assinatura);
+            printf("Gerado: %s com %ld inteiros (%s)\n", path, n, NomeDistribuicao(distribuicao));
         }
+    }
 
-        int anterior, atual;
-        size_t lidos;
+    printf("\n");
 
-        lidos = fread(&anterior, sizeof(int), 1, file);
-        if (lidos != 1) {
-            if (feof(file)) {
-                printf("O arquivo %s está vazio.\n", path);
-            } else {
-                perror("Erro ao ler o arquivo");
-            }
-            fclose(file);
+}
+
+/*
+    ValorFaixaCompleta: converte um número aleatório de 64 bits em um valor do tipo T
+    (bits truncados para inteiros; uniforme entre -1e9 e 1e9 para ponto flutuante).
+ */
+template <typename T>
+static inline T ValorFaixaCompleta(uint64_t aleatorio)
+{
+    if (std::is_floating_point<T>::value)
+    {
+        return (T)(-1e9 + 2e9 * ((double)(aleatorio >> 11) * (1.0 / 9007199254740992.0)));
+    }
+    return (T)aleatorio;
+}
+
+/*
+    GerarArquivosFaixaCompleta: gera arquivos binários com valores aleatórios do tipo T
+    cobrindo toda a faixa do tipo, incluindo negativos (ao contrário do GerarArquivos,
+    que gera apenas inteiros entre 0 e 100 milhões).
+
+    Parâmetros:
+        - tamanho_arquivos: número de elementos de cada arquivo
+        - nomes_arquivos: caminhos dos arquivos a serem gerados
+        - num_arquivos: número de arquivos
+        - semente: semente do gerador; a mesma semente gera sempre os mesmos arquivos
+        - T: tipo dos elementos (int32_t, uint64_t, int64_t, float, ...)
+
+    Retorno:
+        - "faixa_completa", o rótulo da distribuição nos CSVs
+
+    Funcionamento:
+        - Gera os arquivos em paralelo (GerarArquivoParalelo), convertendo os valores com
+          ValorFaixaCompleta<T>
+        - Registra a assinatura de cada arquivo, como o GerarArquivos
+ */
+template <typename T>
+const char *GerarArquivosFaixaCompleta(const long *tamanho_arquivos, const char **nomes_arquivos, const int num_arquivos,
+                                       uint64_t semente = SEMENTE_PADRAO)
+{
+
+    for (int i = 0; i < num_arquivos; i++)
+    {
+        long n = tamanho_arquivos[i];
+        const char *path = nomes_arquivos[i];
+
+        AssinaturaMulticonjunto assinatura;
+        if (GerarArquivoParalelo<T>(path, n, semente, ValorFaixaCompleta<T>, &assinatura))
+        {
+            RegistrarAssinatura(path, &assinatura);
+            printf("Gerado: %s com %ld valores do tipo de %zu bytes\n", path, n, sizeof(T));
+        }
+    }
+
+    printf("\n");
+    return "faixa_completa";
+}
+
+/*
+    GerarArquivosRegistros: gera arquivos de registros (registros.h) com chave int na
+    distribuição DIST_REGISTROS e carga do tipo P, no layout 'layout'.
+
+    Parâmetros e retorno:
+        - os mesmos do GerarArquivosFaixaCompleta; o rótulo é o de DIST_REGISTROS
+
+    Funcionamento:
+        - As chaves são as do arquivo de int da distribuição (mesma semente), e a carga do
+          registro da posição i é CargaRegistro<P>::Criar(i)
+        - AoS: PreencherParalelo gera os registros inteiros e calcula a assinatura
+        - SoA: as chaves e as cargas são geradas em dois vetores e a assinatura dos registros
+          é calculada depois (ConferirRegistros), igual à do mesmo arquivo em AoS
+        - Registra a assinatura de cada arquivo
+ */
+template <typename P, LayoutRegistros layout>
+const char *GerarArquivosRegistros(const long *tamanho_arquivos, const char **nomes_arquivos, const int num_arquivos,
+                                   uint64_t semente = SEMENTE_PADRAO)
+{
+    typedef Registro<int, P> R;
+
+    for (int i = 0; i < num_arquivos; i++)
+    {
+        long n = tamanho_arquivos[i];
+        const char *path = nomes_arquivos[i];
+
+        ArquivoMapeado arquivo;
+        if (!CriarArquivoMapeado(path, (size_t)n * sizeof(R), &arquivo))
+        {
             continue;
         }
 
-        long pos = 1;
-        bool desordenado = false;
-        while ((lidos = fread(&atual, sizeof(int), 1, file)) == 1) {
-            if (atual < anterior) {
-                printf("Erro: arquivo %s está desordenado na posição %ld (anterior=%d > atual=%d)\n",
-                       path, pos, anterior, atual);
-                desordenado = true;
-                break;
-            }
-            anterior = atual;
-            pos++;
+        uint64_t semente_arquivo = SementeDistribuicao(semente, DIST_REGISTROS, n);
+        AssinaturaMulticonjunto assinatura;
+        if (layout == LAYOUT_AOS)
+        {
+            GeradorRegistro<P> gerador;
+            gerador.chaves = CriarGeradorDistribuicao(DIST_REGISTROS, n);
+            PreencherParalelo<R>((R *)arquivo.dados, n, semente_arquivo, gerador, &assinatura);
         }
+        else
+        {
+            int *chaves;
+            P *cargas;
+            VetoresSoA(arquivo.dados, n, &chaves, &cargas);
+            PreencherParalelo<int>(chaves, n, semente_arquivo, CriarGeradorDistribuicao(DIST_REGISTROS, n));
+            PreencherParalelo<P>(cargas, n, semente_arquivo, GeradorCarga<P>());
 
-        if (!desordenado) {
-            printf("O arquivo %s está ordenado.\n", path);
+            VisaoRegistros<int, P> visao;
+            visao.registros = NULL;
+            visao.chaves = chaves;
+            visao.cargas = cargas;
+            long desordenado, instavel;
+            ConferirRegistros(visao, n, &desordenado, &instavel, &assinatura);
         }
 
-        fclose(file);
+        DesmapearArquivo(&arquivo);
+        RegistrarAssinatura(path, &assinatura);
+        printf("Gerado: %s com %ld registros de %zu bytes (%s, %s, %s)\n", path, n, sizeof(R),
+               CargaRegistro<P>::Nome(), NomeLayout(layout), NomeDistribuicao(DIST_REGISTROS));
     }
+
+    printf("\n");
+    return NomeDistribuicao(DIST_REGISTROS);
 }
 
-void GerarArquivos(const long *tamanho_arquivos, const char **nomes_arquivos, const int num_arquivos) 
+/*
+    GerarArquivosArgsort: gera arquivos de argsort: n chaves int na distribuição DIST_REGISTROS
+    seguidas de espaço para n índices uint32_t (zerados).
+
+    Parâmetros e retorno:
+        - os mesmos do GerarArquivosFaixaCompleta; o rótulo é o de DIST_REGISTROS
+
+    Funcionamento:
+        - Registra a assinatura das chaves, que o VerificarArgsort usa para conferir que elas
+          não foram alteradas
+ */
+const char *GerarArquivosArgsort(const long *tamanho_arquivos, const char **nomes_arquivos, const int num_arquivos,
+                                 uint64_t semente = SEMENTE_PADRAO)
 {
-    for (int i = 0; i < num_arquivos; i++) 
+
+    for (int i = 0; i < num_arquivos; i++)
     {
         long n = tamanho_arquivos[i];
         const char *path = nomes_arquivos[i];
 
-        FILE *file = fopen(path, "wb");
-        if (!file) 
+        ArquivoMapeado arquivo;
+        if (!CriarArquivoMapeado(path, (size_t)n * (sizeof(int) + sizeof(uint32_t)), &arquivo))
         {
-            perror(path);
             continue;
         }
 
-        for (long j = 0; j < n; j++) 
+        AssinaturaMulticonjunto assinatura;
+        PreencherParalelo<int>((int *)arquivo.dados, n, SementeDistribuicao(semente, DIST_REGISTROS, n),
+                               CriarGeradorDistribuicao(DIST_REGISTROS, n), &assinatura);
+
+        DesmapearArquivo(&arquivo);
+        RegistrarAssinatura(path, &assinatura);
+        printf("Gerado: %s com %ld chaves para o argsort (%s)\n", path, n, NomeDistribuicao(DIST_REGISTROS));
+    }
+
+    printf("\n");
+    return NomeDistribuicao(DIST_REGISTROS);
+}
+
+/*
+    CaminhoCache: caminho da cópia de 'entrada' no cache (DIR_CACHE_ENTRADAS/<nome do arquivo>).
+ */
+void CaminhoCache(const char *entrada, char *caminho, size_t tamanho)
+{
+    const char *nome = strrchr(entrada, '/');
+    nome = nome ? nome + 1 : entrada;
+    snprintf(caminho, tamanho, "%s/%s", DIR_CACHE_ENTRADAS, nome);
+}
+
+/*
+    GerarEntradasCache: gera as entradas uma única vez no cache (DIR_CACHE_ENTRADAS), como o
+    GerarArquivos, sem criar os arquivos de 'nomes_arquivos'.
+
+    Parâmetros:
+        - os mesmos do GerarArquivos
+
+    Funcionamento:
+        - Cada Exec* sobrescreve a entrada com o resultado ordenado; em vez de gerar os arquivos
+          de novo antes de cada algoritmo, RestaurarEntradas copia as entradas do cache, e todos
+          os algoritmos recebem exatamente os mesmos bytes
+        - A assinatura de cada arquivo é registrada com o caminho da entrada (e não o do
+          cache), já que é a entrada restaurada que o VerificarOrdenado confere
+ */
+void GerarEntradasCache(const long *tamanho_arquivos, const char **nomes_arquivos, const int num_arquivos,
+                        Distribuicao distribuicao = DIST_UNIFORME, uint64_t semente = SEMENTE_PADRAO)
+{
+    if (mkdir(DIR_CACHE_ENTRADAS, 0755) != 0 && errno != EEXIST)
+    {
+        perror(DIR_CACHE_ENTRADAS);
+    }
+
+    for (int i = 0; i < num_arquivos; i++)
+    {
+        long n = tamanho_arquivos[i];
+        char path[512];
+        CaminhoCache(nomes_arquivos[i], path, sizeof(path));
+
+        AssinaturaMulticonjunto assinatura;
+        if (GerarArquivoDistribuicao(path, n, distribuicao, semente, &assinatura))
         {
-            int num = rand() % 100000000;  // gera número aleatório entre 0 e 100 milhões
-            if (fwrite(&num, sizeof(int), 1, file) != 1) 
-            {
-                perror("Erro ao escrever no arquivo");
-                fclose(file);
-                break;
-            }
+            RegistrarAssinatura(nomes_arquivos[i], &assinatura);
+            printf("Gerado: %s com %ld inteiros (%s)\n", path, n, NomeDistribuicao(distribuicao));
         }
-
-        fclose(file);
-        printf("Gerado: %s com %ld inteiros\n", path, n);
     }
 
     printf("\n");
+}
+
+/*
+    RestaurarEntrada: copia a entrada 'nome_arquivo' do cache (CaminhoCache) sobre o arquivo.
+        - Usada também por config_medicao.restaurar, entre as repetições dos Exec*
+ */
+bool RestaurarEntrada(const char *nome_arquivo)
+{
+    char path[512];
+    CaminhoCache(nome_arquivo, path, sizeof(path));
+    return CopiarArquivo(path, nome_arquivo);
+}
+
+/*
+    GuardarEntradasCache: copia os arquivos 'nomes_arquivos', gerados fora do cache (por exemplo
+    com GerarArquivosFaixaCompleta), para o cache, para que possam ser restaurados.
+ */
+void GuardarEntradasCache(const char **nomes_arquivos, const int num_arquivos)
+{
+    if (mkdir(DIR_CACHE_ENTRADAS, 0755) != 0 && errno != EEXIST)
+    {
+        perror(DIR_CACHE_ENTRADAS);
+    }
+
+    for (int i = 0; i < num_arquivos; i++)
+    {
+        char path[512];
+        CaminhoCache(nomes_arquivos[i], path, sizeof(path));
+        CopiarArquivo(nomes_arquivos[i], path);
+    }
+}
 
-}
\ No newline at end of file
+/*
+    RestaurarEntradas: copia as entradas geradas por GerarEntradasCache do cache para
+    'nomes_arquivos', desfazendo a ordenação do algoritmo anterior.
+
+    Funcionamento:
+        - Usa CopiarArquivo (reflink ou copy_file_range), muito mais rápido que gerar os
+          valores de novo
+ */
+void RestaurarEntradas(const char **nomes_arquivos, const int num_arquivos)
+{
+    for (int i = 0; i < num_arquivos; i++)
+    {
+        RestaurarEntrada(nomes_arquivos[i]);
+    }
+}
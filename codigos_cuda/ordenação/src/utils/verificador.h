@@ -0,0 +1,789 @@
+// ============================================================
+//                  Observações gerais
+// ============================================================
+/*
+    Este arquivo implementa a verificação dos arquivos ordenados (VerificarOrdenado).
+    O fluxo geral é:
+        1. Mapeia o arquivo em memória (MapearArquivo)
+        2. Divide o vetor em faixas contíguas, uma por thread
+        3. Cada thread confere se a sua faixa está em ordem crescente, incluindo a fronteira
+           com a faixa anterior (vetor[inicio - 1] <= vetor[inicio]), e calcula a assinatura
+           do multiconjunto dos seus valores
+        4. Junta os resultados: a primeira posição fora de ordem e a assinatura do arquivo,
+           comparada com a registrada na geração (RegistrarAssinatura)
+
+    Apenas a ordem não basta: uma ordenação que perde ou duplica elementos ainda produz um
+    arquivo em ordem crescente. A assinatura (gerador.h) detecta esses casos.
+
+    Os arquivos de registros (registros.h) e de argsort têm verificações próprias
+    (VerificarRegistros, VerificarArgsort), que também conferem a estabilidade: registros
+    com a mesma chave devem manter a ordem das linhas originais.
+
+    Os modos de seleção (selecao.h) não ordenam o arquivo inteiro; VerificarSelecao compara o
+    resultado com uma cópia totalmente ordenada.
+*/
+
+#pragma once
+
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <algorithm>
+
+#include "arquivo_mapeado.h"
+#include "gerador.h"
+#include "registros.h"
+#include "selecao.h"
+
+#define MAX_ASSINATURAS 64
+
+/*
+    MAX_ASSINATURAS: número máximo de arquivos com assinatura registrada ao mesmo tempo.
+*/
+
+// ============================================================
+//                  REGISTRO DAS ASSINATURAS
+// ============================================================
+/*
+    Estrutura RegistroAssinatura: assinatura dos valores gerados para um arquivo de entrada.
+
+    Campos:
+        - caminho: caminho do arquivo de entrada
+        - assinatura: assinatura calculada na geração
+ */
+struct RegistroAssinatura {
+    char caminho[256];
+    AssinaturaMulticonjunto assinatura;
+};
+
+static RegistroAssinatura registros_assinatura[MAX_ASSINATURAS];
+static int num_registros_assinatura = 0;
+
+/*
+    BuscarAssinatura: assinatura registrada para 'caminho', ou NULL se não houver.
+ */
+const AssinaturaMulticonjunto *BuscarAssinatura(const char *caminho)
+{
+    for (int i = 0; i < num_registros_assinatura; i++)
+    {
+        if (strcmp(registros_assinatura[i].caminho, caminho) == 0)
+        {
+            return &registros_assinatura[i].assinatura;
+        }
+    }
+    return NULL;
+}
+
+/*
+    RegistrarAssinatura: registra (ou substitui) a assinatura dos valores gerados para 'caminho'.
+        - Chamada pelas funções de geração de utils.h; o VerificarOrdenado compara com ela
+          a assinatura do arquivo ordenado
+ */
+void RegistrarAssinatura(const char *caminho, const AssinaturaMulticonjunto *assinatura)
+{
+    for (int i = 0; i < num_registros_assinatura; i++)
+    {
+        if (strcmp(registros_assinatura[i].caminho, caminho) == 0)
+        {
+            registros_assinatura[i].assinatura = *assinatura;
+            return;
+        }
+    }
+
+    if (num_registros_assinatura == MAX_ASSINATURAS || strlen(caminho) >= sizeof(registros_assinatura[0].caminho))
+    {
+        fprintf(stderr, "Aviso: assinatura de %s não registrada\n", caminho);
+        return;
+    }
+
+    RegistroAssinatura *registro = &registros_assinatura[num_registros_assinatura++];
+    strcpy(registro->caminho, caminho);
+    registro->assinatura = *assinatura;
+}
+
+// ============================================================
+//                  Estrutura de dados para threads
+// ============================================================
+/*
+    Estrutura VerificadorThreadDados: faixa do vetor conferida por uma thread.
+
+    Campos:
+        - dados: início do arquivo mapeado
+        - inicio: índice inicial (inclusivo) da faixa
+        - fim: índice final (exclusivo) da faixa
+        - desordenado: primeira posição i da faixa com dados[i - 1] > dados[i], ou -1 (saída)
+        - assinatura: assinatura dos valores da faixa (saída)
+ */
+template <typename T>
+struct VerificadorThreadDados {
+    const T *dados;
+    long inicio;
+    long fim;
+    long desordenado;
+    AssinaturaMulticonjunto assinatura;
+};
+
+/*
+    ThreadVerificador: confere a ordem e calcula a assinatura da faixa [inicio, fim).
+
+    Funcionamento:
+        - A comparação começa em max(inicio, 1), com o último elemento da faixa anterior,
+          para que as fronteiras entre as faixas também sejam conferidas
+        - O laço apenas conta as inversões, sem desvios; a posição da primeira é procurada
+          depois, somente se houver alguma
+ */
+template <typename T>
+void *ThreadVerificador(void *arg)
+{
+    VerificadorThreadDados<T> *dados = (VerificadorThreadDados<T> *)arg;
+    const T *vetor = dados->dados;
+
+    AssinaturaMulticonjunto assinatura;
+    IniciarAssinatura(&assinatura);
+    for (long i = dados->inicio; i < dados->fim; i++)
+    {
+        AcumularAssinatura(&assinatura, HashValor<T>(vetor[i]));
+    }
+    dados->assinatura = assinatura;
+
+    long primeiro = dados->inicio > 0 ? dados->inicio : 1;
+    long inversoes = 0;
+    for (long i = primeiro; i < dados->fim; i++)
+    {
+        inversoes += vetor[i] < vetor[i - 1];
+    }
+
+    dados->desordenado = -1;
+    if (inversoes > 0)
+    {
+        for (long i = primeiro; i < dados->fim; i++)
+        {
+            if (vetor[i] < vetor[i - 1])
+            {
+                dados->desordenado = i;
+                break;
+            }
+        }
+    }
+
+    pthread_exit(0);
+}
+
+// ============================================================
+//                  FUNÇÃO PRINCIPAL DO VERIFICADOR
+// ============================================================
+/*
+    VerificarOrdenado: verifica se os arquivos binários estão em ordem crescente e se contêm
+    os mesmos elementos gerados para eles.
+
+    Parâmetros:
+        - arquivos: array de caminhos (const char*) para arquivos binários
+        - num_entradas: número de entradas no array
+        - T: tipo dos elementos gravados no arquivo (int por padrão; também int64_t,
+          uint64_t, float, ...)
+
+    Funcionamento:
+        - Mapeia cada arquivo e o confere em paralelo com ThreadsParaElementos(n) threads
+        - Informa a primeira posição fora de ordem, se houver
+        - Se o arquivo tiver uma assinatura registrada na geração, compara as assinaturas;
+          arquivos sem assinatura têm apenas a ordem conferida
+ */
+template <typename T = int>
+void VerificarOrdenado(const char **arquivos, const int num_entradas)
+{
+    for (int i = 0; i < num_entradas; i++)
+    {
+        const char *path = arquivos[i];
+
+        ArquivoMapeado arquivo;
+        if (!MapearArquivo(path, &arquivo))
+        {
+            continue;
+        }
+
+        long n = (long)(arquivo.bytes / sizeof(T));
+        const AssinaturaMulticonjunto *esperada = BuscarAssinatura(path);
+
+        if (n == 0)
+        {
+            printf("O arquivo %s está vazio.\n", path);
+            if (esperada && esperada->elementos != 0)
+            {
+                printf("Erro: arquivo %s deveria ter %ld elementos.\n", path, esperada->elementos);
+            }
+            DesmapearArquivo(&arquivo);
+            continue;
+        }
+
+        const T *dados = (const T *)arquivo.dados;
+        long num_threads = ThreadsParaElementos(n);
+        pthread_t *threads = new pthread_t[num_threads];
+        VerificadorThreadDados<T> *args = new VerificadorThreadDados<T>[num_threads];
+
+        for (long t = 0; t < num_threads; t++)
+        {
+            args[t].dados = dados;
+            args[t].inicio = (n * t) / num_threads;
+            args[t].fim = (n * (t + 1)) / num_threads;
+
+            pthread_create(&threads[t], NULL, ThreadVerificador<T>, &args[t]);
+        }
+
+        long desordenado = -1;
+        AssinaturaMulticonjunto assinatura;
+        IniciarAssinatura(&assinatura);
+        for (long t = 0; t < num_threads; t++)
+        {
+            pthread_join(threads[t], NULL);
+            if (desordenado < 0)
+            {
+                desordenado = args[t].desordenado;
+            }
+            CombinarAssinaturas(&assinatura, &args[t].assinatura);
+        }
+
+        bool correto = true;
+        if (desordenado >= 0)
+        {
+            std::cout << "Erro: arquivo " << path << " está desordenado na posição " << desordenado
+                      << " (anterior=" << dados[desordenado - 1] << " > atual=" << dados[desordenado] << ")" << std::endl;
+            correto = false;
+        }
+        if (esperada && !AssinaturasIguais(&assinatura, esperada))
+        {
+            printf("Erro: arquivo %s não contém os elementos gerados (%ld elementos, esperados %ld; assinatura diferente)\n",
+                   path, assinatura.elementos, esperada->elementos);
+            correto = false;
+        }
+
+        if (correto)
+        {
+            printf("O arquivo %s está ordenado.\n", path);
+        }
+
+        delete[] threads;
+        delete[] args;
+        DesmapearArquivo(&arquivo);
+    }
+}
+
+// ============================================================
+//          VERIFICAÇÃO DOS REGISTROS (CHAVE-VALOR)
+// ============================================================
+/*
+    Estrutura VisaoRegistros: acesso aos registros de um arquivo mapeado em qualquer layout.
+
+    Campos:
+        - registros: vetor de registros (AoS), ou NULL no SoA
+        - chaves, cargas: vetores das chaves e das cargas (SoA)
+ */
+template <typename K, typename P>
+struct VisaoRegistros {
+    const Registro<K, P> *registros;
+    const K *chaves;
+    const P *cargas;
+
+    Registro<K, P> Ler(long i) const
+    {
+        if (registros)
+            return registros[i];
+
+        Registro<K, P> registro;
+        registro.chave = chaves[i];
+        registro.carga = cargas[i];
+        return registro;
+    }
+};
+
+/*
+    Estrutura VerificadorRegistrosThreadDados: faixa dos registros conferida por uma thread.
+
+    Campos:
+        - visao: registros do arquivo
+        - inicio, fim: faixa [inicio, fim)
+        - desordenado: primeira posição i da faixa com chave[i - 1] > chave[i], ou -1 (saída)
+        - instavel: primeira posição i da faixa com chave[i - 1] == chave[i] e linha[i - 1] >
+          linha[i], ou -1 (saída)
+        - assinatura: assinatura dos registros inteiros (chave e carga) da faixa (saída)
+ */
+template <typename K, typename P>
+struct VerificadorRegistrosThreadDados {
+    const VisaoRegistros<K, P> *visao;
+    long inicio;
+    long fim;
+    long desordenado;
+    long instavel;
+    AssinaturaMulticonjunto assinatura;
+};
+
+/*
+    ThreadVerificadorRegistros: confere a ordem e a estabilidade e calcula a assinatura dos
+    registros da faixa [inicio, fim), incluindo a fronteira com a faixa anterior.
+ */
+template <typename K, typename P>
+void *ThreadVerificadorRegistros(void *arg)
+{
+    VerificadorRegistrosThreadDados<K, P> *dados = (VerificadorRegistrosThreadDados<K, P> *)arg;
+    const VisaoRegistros<K, P> &visao = *dados->visao;
+
+    AssinaturaMulticonjunto assinatura;
+    IniciarAssinatura(&assinatura);
+    dados->desordenado = -1;
+    dados->instavel = -1;
+
+    for (long i = dados->inicio; i < dados->fim; i++)
+    {
+        Registro<K, P> atual = visao.Ler(i);
+        AcumularAssinatura(&assinatura, HashValor<Registro<K, P>>(atual));
+
+        if (i == 0)
+            continue;
+
+        Registro<K, P> anterior = visao.Ler(i - 1);
+        if (atual.chave < anterior.chave)
+        {
+            if (dados->desordenado < 0)
+                dados->desordenado = i;
+        }
+        else if (!(anterior.chave < atual.chave) &&
+                 CargaRegistro<P>::Linha(anterior.carga) > CargaRegistro<P>::Linha(atual.carga))
+        {
+            if (dados->instavel < 0)
+                dados->instavel = i;
+        }
+    }
+
+    dados->assinatura = assinatura;
+
+    pthread_exit(0);
+}
+
+/*
+    ConferirRegistros: confere os 'n' registros de 'visao' em paralelo.
+
+    Parâmetros:
+        - visao, n: registros
+        - desordenado, instavel: primeira posição fora de ordem e primeira posição instável,
+          ou -1
+        - assinatura: assinatura dos registros (chave e carga)
+
+    Funcionamento:
+        - Usa ThreadsParaElementos(n) threads, cada uma com uma faixa contígua
+        - Também calcula a assinatura dos arquivos SoA na geração (GerarArquivosRegistros)
+ */
+template <typename K, typename P>
+void ConferirRegistros(const VisaoRegistros<K, P> &visao, long n, long *desordenado, long *instavel,
+                       AssinaturaMulticonjunto *assinatura)
+{
+    long num_threads = ThreadsParaElementos(n);
+    pthread_t *threads = new pthread_t[num_threads];
+    VerificadorRegistrosThreadDados<K, P> *args = new VerificadorRegistrosThreadDados<K, P>[num_threads];
+
+    for (long t = 0; t < num_threads; t++)
+    {
+        args[t].visao = &visao;
+        args[t].inicio = (n * t) / num_threads;
+        args[t].fim = (n * (t + 1)) / num_threads;
+
+        pthread_create(&threads[t], NULL, ThreadVerificadorRegistros<K, P>, &args[t]);
+    }
+
+    *desordenado = -1;
+    *instavel = -1;
+    IniciarAssinatura(assinatura);
+    for (long t = 0; t < num_threads; t++)
+    {
+        pthread_join(threads[t], NULL);
+        if (*desordenado < 0)
+            *desordenado = args[t].desordenado;
+        if (*instavel < 0)
+            *instavel = args[t].instavel;
+        CombinarAssinaturas(assinatura, &args[t].assinatura);
+    }
+
+    delete[] threads;
+    delete[] args;
+}
+
+/*
+    VerificarRegistros: verifica se os arquivos de registros com chave int e carga do tipo P,
+    no layout 'layout', estão ordenados pela chave, de forma estável, e com as cargas intactas.
+
+    Parâmetros:
+        - arquivos: array de caminhos (const char*) para arquivos de registros
+        - num_entradas: número de entradas no array
+
+    Funcionamento:
+        - Mapeia cada arquivo e o confere com ConferirRegistros
+        - Estabilidade: registros com a mesma chave devem estar em ordem crescente de linha
+          (CargaRegistro<P>::Linha, a posição original)
+        - Integridade das cargas: a assinatura é calculada sobre o registro inteiro, então uma
+          carga trocada de registro, perdida ou alterada muda a assinatura registrada na geração
+ */
+template <typename P, LayoutRegistros layout>
+void VerificarRegistros(const char **arquivos, const int num_entradas)
+{
+    typedef Registro<int, P> R;
+
+    for (int i = 0; i < num_entradas; i++)
+    {
+        const char *path = arquivos[i];
+
+        ArquivoMapeado arquivo;
+        if (!MapearArquivo(path, &arquivo))
+        {
+            continue;
+        }
+
+        long n = (long)(arquivo.bytes / sizeof(R));
+        if (n == 0)
+        {
+            printf("O arquivo %s está vazio.\n", path);
+            DesmapearArquivo(&arquivo);
+            continue;
+        }
+
+        VisaoRegistros<int, P> visao;
+        visao.registros = NULL;
+        if (layout == LAYOUT_AOS)
+        {
+            visao.registros = (const R *)arquivo.dados;
+        }
+        else
+        {
+            int *chaves;
+            P *cargas;
+            VetoresSoA(arquivo.dados, n, &chaves, &cargas);
+            visao.chaves = chaves;
+            visao.cargas = cargas;
+        }
+
+        long desordenado, instavel;
+        AssinaturaMulticonjunto assinatura;
+        ConferirRegistros(visao, n, &desordenado, &instavel, &assinatura);
+
+        bool correto = true;
+        if (desordenado >= 0)
+        {
+            printf("Erro: arquivo %s está desordenado na posição %ld (anterior=%d > atual=%d)\n", path, desordenado,
+                   visao.Ler(desordenado - 1).chave, visao.Ler(desordenado).chave);
+            correto = false;
+        }
+        if (instavel >= 0)
+        {
+            printf("Erro: arquivo %s não está estável na posição %ld (chave %d, linhas %u e %u)\n", path, instavel,
+                   visao.Ler(instavel).chave, CargaRegistro<P>::Linha(visao.Ler(instavel - 1).carga),
+                   CargaRegistro<P>::Linha(visao.Ler(instavel).carga));
+            correto = false;
+        }
+
+        const AssinaturaMulticonjunto *esperada = BuscarAssinatura(path);
+        if (esperada && !AssinaturasIguais(&assinatura, esperada))
+        {
+            printf("Erro: arquivo %s não contém os registros gerados (%ld registros, esperados %ld; chaves ou cargas alteradas)\n",
+                   path, assinatura.elementos, esperada->elementos);
+            correto = false;
+        }
+
+        if (correto)
+        {
+            printf("O arquivo %s está ordenado (estável, cargas intactas).\n", path);
+        }
+
+        DesmapearArquivo(&arquivo);
+    }
+}
+
+// ============================================================
+//                  VERIFICAÇÃO DO ARGSORT
+// ============================================================
+/*
+    Estrutura VerificadorArgsortThreadDados: faixa da permutação conferida por uma thread.
+
+    Campos:
+        - chaves, indices, n: vetores do arquivo de argsort
+        - inicio, fim: faixa [inicio, fim)
+        - invalido: primeira posição com índice >= n, ou -1 (saída)
+        - desordenado: primeira posição i com chaves[indices[i - 1]] > chaves[indices[i]], ou -1
+        - instavel: primeira posição i com chaves iguais e indices[i - 1] > indices[i], ou -1
+        - chaves_lidas: assinatura das chaves da faixa, comparada com a da geração (saída)
+        - indices_lidos, indices_esperados: assinaturas dos índices da faixa e dos números
+          inicio, ..., fim - 1; iguais no total se os índices forem uma permutação (saída)
+ */
+struct VerificadorArgsortThreadDados {
+    const int *chaves;
+    const uint32_t *indices;
+    long n;
+    long inicio;
+    long fim;
+    long invalido;
+    long desordenado;
+    long instavel;
+    AssinaturaMulticonjunto chaves_lidas;
+    AssinaturaMulticonjunto indices_lidos;
+    AssinaturaMulticonjunto indices_esperados;
+};
+
+/*
+    ThreadVerificadorArgsort: confere a faixa [inicio, fim) da permutação.
+ */
+void *ThreadVerificadorArgsort(void *arg)
+{
+    VerificadorArgsortThreadDados *dados = (VerificadorArgsortThreadDados *)arg;
+    const int *chaves = dados->chaves;
+    const uint32_t *indices = dados->indices;
+    long n = dados->n;
+
+    IniciarAssinatura(&dados->chaves_lidas);
+    IniciarAssinatura(&dados->indices_lidos);
+    IniciarAssinatura(&dados->indices_esperados);
+    dados->invalido = dados->desordenado = dados->instavel = -1;
+
+    for (long i = dados->inicio; i < dados->fim; i++)
+    {
+        AcumularAssinatura(&dados->chaves_lidas, HashValor<int>(chaves[i]));
+        AcumularAssinatura(&dados->indices_lidos, HashValor<uint32_t>(indices[i]));
+        AcumularAssinatura(&dados->indices_esperados, HashValor<uint32_t>((uint32_t)i));
+
+        if (indices[i] >= (uint64_t)n)
+        {
+            if (dados->invalido < 0)
+                dados->invalido = i;
+            continue;
+        }
+        if (i == 0 || indices[i - 1] >= (uint64_t)n)
+            continue;
+
+        int anterior = chaves[indices[i - 1]];
+        int atual = chaves[indices[i]];
+        if (atual < anterior)
+        {
+            if (dados->desordenado < 0)
+                dados->desordenado = i;
+        }
+        else if (atual == anterior && indices[i - 1] > indices[i])
+        {
+            if (dados->instavel < 0)
+                dados->instavel = i;
+        }
+    }
+
+    pthread_exit(0);
+}
+
+/*
+    VerificarArgsort: verifica os arquivos de argsort (n chaves int seguidas de n índices
+    uint32_t, registros.h).
+
+    Parâmetros:
+        - arquivos: array de caminhos (const char*) para arquivos de argsort
+        - num_entradas: número de entradas no array
+
+    Funcionamento:
+        - Os índices devem formar uma permutação de 0..n-1 (todos menores que n, e a assinatura
+          igual à dos números 0..n-1) que ordena as chaves de forma estável
+        - As chaves não podem ter sido alteradas: a assinatura delas é comparada com a
+          registrada na geração
+ */
+void VerificarArgsort(const char **arquivos, const int num_entradas)
+{
+    typedef Registro<int, uint32_t> R;
+
+    for (int i = 0; i < num_entradas; i++)
+    {
+        const char *path = arquivos[i];
+
+        ArquivoMapeado arquivo;
+        if (!MapearArquivo(path, &arquivo))
+        {
+            continue;
+        }
+
+        long n = (long)(arquivo.bytes / sizeof(R));
+        if (n == 0)
+        {
+            printf("O arquivo %s está vazio.\n", path);
+            DesmapearArquivo(&arquivo);
+            continue;
+        }
+
+        int *chaves;
+        uint32_t *indices;
+        VetoresSoA(arquivo.dados, n, &chaves, &indices);
+
+        long num_threads = ThreadsParaElementos(n);
+        pthread_t *threads = new pthread_t[num_threads];
+        VerificadorArgsortThreadDados *args = new VerificadorArgsortThreadDados[num_threads];
+
+        for (long t = 0; t < num_threads; t++)
+        {
+            args[t].chaves = chaves;
+            args[t].indices = indices;
+            args[t].n = n;
+            args[t].inicio = (n * t) / num_threads;
+            args[t].fim = (n * (t + 1)) / num_threads;
+
+            pthread_create(&threads[t], NULL, ThreadVerificadorArgsort, &args[t]);
+        }
+
+        long invalido = -1, desordenado = -1, instavel = -1;
+        AssinaturaMulticonjunto chaves_lidas, indices_lidos, indices_esperados;
+        IniciarAssinatura(&chaves_lidas);
+        IniciarAssinatura(&indices_lidos);
+        IniciarAssinatura(&indices_esperados);
+        for (long t = 0; t < num_threads; t++)
+        {
+            pthread_join(threads[t], NULL);
+            if (invalido < 0)
+                invalido = args[t].invalido;
+            if (desordenado < 0)
+                desordenado = args[t].desordenado;
+            if (instavel < 0)
+                instavel = args[t].instavel;
+            CombinarAssinaturas(&chaves_lidas, &args[t].chaves_lidas);
+            CombinarAssinaturas(&indices_lidos, &args[t].indices_lidos);
+            CombinarAssinaturas(&indices_esperados, &args[t].indices_esperados);
+        }
+
+        bool correto = true;
+        if (invalido >= 0)
+        {
+            printf("Erro: arquivo %s tem um índice inválido na posição %ld (%u >= %ld)\n", path, invalido,
+                   indices[invalido], n);
+            correto = false;
+        }
+        else if (!AssinaturasIguais(&indices_lidos, &indices_esperados))
+        {
+            printf("Erro: os índices do arquivo %s não são uma permutação de 0..%ld\n", path, n - 1);
+            correto = false;
+        }
+        if (desordenado >= 0)
+        {
+            printf("Erro: arquivo %s está desordenado na posição %ld (anterior=%d > atual=%d)\n", path, desordenado,
+                   chaves[indices[desordenado - 1]], chaves[indices[desordenado]]);
+            correto = false;
+        }
+        if (instavel >= 0)
+        {
+            printf("Erro: arquivo %s não está estável na posição %ld (chave %d, índices %u e %u)\n", path, instavel,
+                   chaves[indices[instavel]], indices[instavel - 1], indices[instavel]);
+            correto = false;
+        }
+
+        const AssinaturaMulticonjunto *esperada = BuscarAssinatura(path);
+        if (esperada && !AssinaturasIguais(&chaves_lidas, esperada))
+        {
+            printf("Erro: as chaves do arquivo %s foram alteradas pelo argsort\n", path);
+            correto = false;
+        }
+
+        if (correto)
+        {
+            printf("O arquivo %s está ordenado (estável, chaves intactas).\n", path);
+        }
+
+        delete[] threads;
+        delete[] args;
+        DesmapearArquivo(&arquivo);
+    }
+}
+
+// ============================================================
+//          VERIFICAÇÃO DOS MODOS DE SELEÇÃO
+// ============================================================
+/*
+    VerificarSelecao: verifica os arquivos deixados pelos seletores (selecao.h), comparando-os
+    com uma cópia totalmente ordenada.
+
+    Parâmetros:
+        - arquivos: array de caminhos (const char*) para arquivos binários (int)
+        - num_entradas: número de entradas no array
+        - modo: o que o seletor garante (SELECAO_NTH ou SELECAO_PREFIXO)
+
+    Funcionamento:
+        - A assinatura do arquivo deve ser a registrada na geração: o seletor só trocou os
+          elementos de posição. Assim, ordenar uma cópia do arquivo dá o mesmo resultado que
+          ordenar a entrada original (std::sort)
+        - SELECAO_NTH: vetor[k - 1] deve ser igual ao da cópia ordenada, nenhum elemento
+          anterior maior que ele e nenhum posterior menor
+        - SELECAO_PREFIXO: vetor[0..k) deve ser igual ao início da cópia ordenada, e nenhum
+          elemento posterior menor que vetor[k - 1]
+ */
+template <ModoSelecao modo>
+void VerificarSelecao(const char **arquivos, const int num_entradas)
+{
+    for (int i = 0; i < num_entradas; i++)
+    {
+        const char *path = arquivos[i];
+
+        ArquivoMapeado arquivo;
+        if (!MapearArquivo(path, &arquivo))
+        {
+            continue;
+        }
+
+        long n = (long)(arquivo.bytes / sizeof(int));
+        if (n == 0)
+        {
+            printf("O arquivo %s está vazio.\n", path);
+            DesmapearArquivo(&arquivo);
+            continue;
+        }
+
+        const int *dados = (const int *)arquivo.dados;
+        long k = ElementosSelecionados(n);
+        bool correto = true;
+
+        AssinaturaMulticonjunto assinatura;
+        IniciarAssinatura(&assinatura);
+        for (long j = 0; j < n; j++)
+        {
+            AcumularAssinatura(&assinatura, HashValor<int>(dados[j]));
+        }
+        const AssinaturaMulticonjunto *esperada = BuscarAssinatura(path);
+        if (esperada && !AssinaturasIguais(&assinatura, esperada))
+        {
+            printf("Erro: arquivo %s não contém os elementos gerados (%ld elementos, esperados %ld; assinatura diferente)\n",
+                   path, assinatura.elementos, esperada->elementos);
+            correto = false;
+        }
+
+        int *ordenado = new int[n];
+        memcpy(ordenado, dados, n * sizeof(int));
+        std::sort(ordenado, ordenado + n);
+
+        int selecionado = dados[k - 1];
+        for (long j = 0; j < k && correto; j++)
+        {
+            bool errado = modo == SELECAO_PREFIXO ? dados[j] != ordenado[j]
+                                                  : (j == k - 1 ? dados[j] != ordenado[j] : dados[j] > selecionado);
+            if (errado)
+            {
+                printf("Erro: arquivo %s tem %d na posição %ld (k = %ld), a ordenação completa tem %d\n",
+                       path, dados[j], j, k, ordenado[j]);
+                correto = false;
+            }
+        }
+        for (long j = k; j < n && correto; j++)
+        {
+            if (dados[j] < selecionado)
+            {
+                printf("Erro: arquivo %s tem %d na posição %ld, menor que o k-ésimo menor (%d, k = %ld)\n",
+                       path, dados[j], j, selecionado, k);
+                correto = false;
+            }
+        }
+
+        if (correto)
+        {
+            printf("O arquivo %s tem os %ld menores elementos selecionados (%s; k-ésimo = %d).\n",
+                   path, k, modo == SELECAO_PREFIXO ? "em ordem" : "nth_element", selecionado);
+        }
+
+        delete[] ordenado;
+        DesmapearArquivo(&arquivo);
+    }
+}